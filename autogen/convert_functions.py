@@ -102,7 +102,7 @@ override_allowed_functions = {
 
 override_disallowed_functions = {
     "src/audio/external.h":                     [ " func_" ],
-    "src/engine/surface_load.h":                [ "load_area_terrain", "alloc_surface_pools", "clear_dynamic_surfaces", "get_area_terrain_size" ],
+    "src/engine/surface_load.h":                [ "load_area_terrain", "alloc_surface_pools", "clear_dynamic_surfaces", "begin_dynamic_surfaces_tick", "unload_stale_dynamic_surfaces", "unload_object_surfaces", "get_area_terrain_size" ],
     "src/engine/surface_collision.h":           [ " debug_", "f32_find_wall_collision" ],
     "src/game/mario_actions_airborne.c":        [ "^[us]32 act_.*" ],
     "src/game/mario_actions_automatic.c":       [ "^[us]32 act_.*" ],
@@ -118,7 +118,7 @@ override_disallowed_functions = {
     "src/game/interaction.h":                   [ "process_interaction", "_handle_" ],
     "src/game/sound_init.h":                    [ "_loop_", "thread4_", "set_sound_mode" ],
     "src/pc/network/network_utils.h":           [ "network_get_player_text_color[^_]" ],
-    "src/pc/network/network_player.h":          [ "_init", "_connected[^_]", "_shutdown", "_disconnected", "_update", "construct_player_popup", "network_player_name_valid" ],
+    "src/pc/network/network_player.h":          [ "_init", "_connected[^_]", "_shutdown", "_disconnected", "_update", "construct_player_popup", "network_player_name_valid", "network_player_location_", "network_player_rx_seq_" ],
     "src/game/object_helpers.c":                [ "spawn_obj", "^bhv_", "abs[fi]", "^bit_shift", "_debug$", "^stub_", "_set_model", "cur_obj_set_direction_table", "cur_obj_progress_direction_table" ],
     "src/game/obj_behaviors.c":                 [ "debug_", "turn_obj_away_from_surface" ],
     "src/game/obj_behaviors_2.c":               [ "wiggler_jumped_on_attack_handler", "huge_goomba_weakly_attacked" ],
@@ -127,7 +127,7 @@ override_disallowed_functions = {
     "src/pc/lua/utils/smlua_obj_utils.h":       [ "spawn_object_remember_field" ],
     "src/game/camera.h":                        [ "update_camera", "init_camera", "stub_camera", "^reset_camera", "move_point_along_spline", "romhack_camera_init_settings", "romhack_camera_reset_settings" ],
     "src/game/behavior_actions.h":              [ "bhv_dust_smoke_loop", "bhv_init_room" ],
-    "src/pc/lua/utils/smlua_audio_utils.h":     [ "smlua_audio_utils_override", "audio_custom_shutdown", "smlua_audio_custom_deinit", "audio_sample_destroy_pending_copies", "audio_custom_update_volume" ],
+    "src/pc/lua/utils/smlua_audio_utils.h":     [ "smlua_audio_utils_override", "smlua_audio_utils_apply_reset_all", "smlua_audio_utils_apply_override", "audio_custom_shutdown", "smlua_audio_custom_deinit", "audio_sample_destroy_pending_copies", "audio_custom_update_volume" ],
     "src/pc/djui/djui_hud_utils.h":             [ "djui_hud_render_texture_raw", "djui_hud_render_texture_tile_raw" ],
     "src/pc/lua/utils/smlua_level_utils.h":     [ "smlua_level_util_reset" ],
     "src/pc/lua/utils/smlua_text_utils.h":      [ "smlua_text_utils_init", "smlua_text_utils_shutdown" ],
@@ -136,7 +136,7 @@ override_disallowed_functions = {
     "src/pc/network/lag_compensation.h":        [ "lag_compensation_clear" ],
     "src/game/first_person_cam.h":              [ "first_person_update" ],
     "src/pc/lua/utils/smlua_collision_utils.h": [ "collision_find_surface_on_ray" ],
-    "src/engine/behavior_script.h":             [ "stub_behavior_script_2", "cur_obj_update" ],
+    "src/engine/behavior_script.h":             [ "stub_behavior_script_2", "cur_obj_update", "behavior_script_benchmark" ],
     "src/pc/utils/misc.h":                      [ "str_.*", "file_get_line", "delta_interpolate_(normal|rgba|mtx)", "detect_and_skip_mtx_interpolation" ],
     "src/engine/lighting_engine.h":             [ "le_calculate_vertex_lighting", "le_clear", "le_shutdown" ]
 }
@@ -222,6 +222,7 @@ manual_index_documentation = """
    - [cast_graph_node](#cast_graph_node)
    - [get_uncolored_string](#get_uncolored_string)
    - [gfx_set_command](#gfx_set_command)
+   - [vec3f_new](#vec3f_new)
 
 <br />
 
@@ -715,6 +716,40 @@ N/A
 
 <br />
 
+## [vec3f_new](#vec3f_new)
+
+Creates a `Vec3f` whose components are stored inside the returned object instead of in a table. Missing components are 0.
+
+Vector functions read and write these objects (and vectors obtained from game structs such as `m.pos`) directly, so reusing one across frames makes no Lua allocations. Fields are accessed like a table, `v.x`, `v.y`, `v.z`.
+
+Every vector type has a constructor: `vec2f_new`, `vec3f_new`, `vec4f_new`, `vec2i_new`, `vec3i_new`, `vec4i_new`, `vec2s_new`, `vec3s_new`, `vec4s_new`, `mat4_new` and `color_new`.
+
+### Lua Example
+```lua
+local sDir = vec3f_new()
+
+hook_event(HOOK_MARIO_UPDATE, function (m)
+    vec3f_dif(sDir, m.pos, gMarioStates[0].pos)
+end)
+```
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| x | `number` (optional) |
+| y | `number` (optional) |
+| z | `number` (optional) |
+
+### Returns
+- [Vec3f](structs.md#Vec3f)
+
+### C Prototype
+N/A
+
+[:arrow_up_small:](#)
+
+<br />
+
 """
 
 ############################################################################
@@ -767,18 +802,64 @@ def build_vec_types():
 
         # Get
         s += "void smlua_get_%s(%s dest, int index) {\n" % (type_name.lower(), type_name)
+        s += "    void *ptr = smlua_get_vec_pointer(gLuaState, index, LOT_%s);\n" % (type_name.upper())
+        s += "    if (ptr) {\n"
+        s += "        memcpy(dest, ptr, sizeof(%s));\n" % (type_name)
+        s += "        gSmLuaConvertSuccess = true;\n"
+        s += "        return;\n"
+        s += "    }\n"
         for lua_field, c_field in vec_type["fields_mapping"].items():
             s += "    dest%s = smlua_get_%s_field(index, \"%s\");\n" % (c_field, vec_type["field_lua_type"], lua_field)
         s += "}\n\n"
 
         # Push
         s += "void smlua_push_%s(%s src, int index) {\n" % (type_name.lower(), type_name)
+        s += "    void *ptr = smlua_get_vec_pointer(gLuaState, index, LOT_%s);\n" % (type_name.upper())
+        s += "    if (ptr) {\n"
+        s += "        memcpy(ptr, src, sizeof(%s));\n" % (type_name)
+        s += "        return;\n"
+        s += "    }\n"
         for lua_field, c_field in vec_type["fields_mapping"].items():
             s += "    smlua_push_%s_field(index, \"%s\", src%s);\n" % (vec_type["field_lua_type"], lua_field, c_field)
         for lua_field, c_field in vec_type.get('optional_fields_mapping', {}).items():
             s += "    smlua_push_%s_field(index, \"%s\", src%s);\n" % (vec_type["field_lua_type"], lua_field, c_field)
         s += "}\n\n"
 
+        # Lua constructor, the components live inside the userdata so filling it
+        # or passing it back to C never allocates a table
+        fields = list(vec_type["fields_mapping"].items())
+        s += "int smlua_func_%s_new(lua_State* L) {\n" % (type_name.lower())
+        s += "    if (L == NULL) { return 0; }\n\n"
+        s += "    int top = lua_gettop(L);\n"
+        s += "    if (top > %d) {\n" % (len(fields))
+        s += "        LOG_LUA_LINE(\"Improper param count for '%%s': Expected at most %%u, Received %%u\", \"%s_new\", %d, top);\n" % (type_name.lower(), len(fields))
+        s += "        return 0;\n"
+        s += "    }\n\n"
+        s += "    %s *dest = smlua_push_vec_object(L, LOT_%s, sizeof(%s));\n" % (type_name, type_name.upper(), type_name)
+        for i, (lua_field, c_field) in enumerate(fields):
+            s += "    if (top >= %d) {\n" % (i + 1)
+            s += "        (*dest)%s = smlua_to_%s(L, %d);\n" % (c_field, vec_type["field_lua_type"], i + 1)
+            s += "        if (!gSmLuaConvertSuccess) { LOG_LUA(\"Failed to convert parameter %%u for function '%%s'\", %d, \"%s_new\"); return 0; }\n" % (i + 1, type_name.lower())
+            s += "    }\n"
+        s += "    return 1;\n"
+        s += "}\n\n"
+
+    return s
+
+def build_vec_binds():
+    s = "\n    // vec types\n"
+    for type_name in VEC_TYPES:
+        s += '    smlua_bind_function(L, "%s_new", smlua_func_%s_new);\n' % (type_name.lower(), type_name.lower())
+    return s
+
+def def_vec_types():
+    s = ''
+    for type_name, vec_type in VEC_TYPES.items():
+        for lua_field in vec_type["fields_mapping"]:
+            s += "--- @param %s? %s\n" % (lua_field, vec_type["field_lua_type"])
+        s += "--- @return %s\n" % (type_name)
+        s += "--- Creates a %s that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate\n" % (type_name)
+        s += "function %s_new(%s)\n    -- ...\nend\n\n" % (type_name.lower(), ", ".join(vec_type["fields_mapping"].keys()))
     return s
 
 ############################################################################
@@ -1375,6 +1456,8 @@ def def_files(processed_files):
         for function in processed_file['functions']:
             s += def_function(processed_file['filename'], function)
 
+    s += def_vec_types()
+
     for def_pointer in def_pointers:
         s += '--- @alias %s %s\n' % (def_pointer, def_pointer[8:])
 
@@ -1391,7 +1474,7 @@ def main():
 
     built_vec_types = build_vec_types()
     built_functions = build_functions(processed_files)
-    built_binds = build_binds(processed_files)
+    built_binds = build_vec_binds() + build_binds(processed_files)
     built_includes = build_includes()
 
     filename = get_path(out_filename)
@@ -90,7 +90,7 @@ override_field_mutable = {
 override_field_invisible = {
     "Mod": [ "files", "showedScriptWarning" ],
     "MarioState": [ "visibleToEnemies" ],
-    "NetworkPlayer": [ "gag", "moderator", "discordId" ],
+    "NetworkPlayer": [ "gag", "moderator", "discordId", "rxSeqWindow" ],
     "GraphNode": [ "_guard1", "_guard2", "padding" ],
     "GraphNodeRoot": ["unk15", "views"],
     "FnGraphNode": [ "luaTokenIndex" ],
@@ -4430,6 +4430,9 @@ NETWORK_PLAYER_TIMEOUT = 15
 --- @type integer
 NETWORK_PLAYER_PING_TIMEOUT = 3
 
+--- @type integer
+RX_SEQ_WINDOW = 1024
+
 --- @type integer
 MAX_RX_SEQ_IDS = 256
 
@@ -10891,7 +10894,7 @@ COOP_OBJ_FLAG_NON_SYNC = (1 << 2)
 COOP_OBJ_FLAG_INITIALIZED = (1 << 3)
 
 --- @type string
-SM64COOPDX_VERSION = "v1.3.2"
+SM64COOPDX_VERSION = "v1.3.3"
 
 --- @type string
 VERSION_TEXT = "v"
@@ -10900,7 +10903,7 @@ VERSION_TEXT = "v"
 VERSION_NUMBER = 40
 
 --- @type integer
-MINOR_VERSION_NUMBER = 2
+MINOR_VERSION_NUMBER = 3
 
 --- @type integer
 MAX_VERSION_LENGTH = 128
@@ -11833,6 +11833,118 @@ function sync_object_is_owned_locally(syncId)
     -- ...
 end
 
+--- @param x? number
+--- @param y? number
+--- @return Vec2f
+--- Creates a Vec2f that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec2f_new(x, y)
+    -- ...
+end
+
+--- @param x? number
+--- @param y? number
+--- @param z? number
+--- @return Vec3f
+--- Creates a Vec3f that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec3f_new(x, y, z)
+    -- ...
+end
+
+--- @param x? number
+--- @param y? number
+--- @param z? number
+--- @param w? number
+--- @return Vec4f
+--- Creates a Vec4f that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec4f_new(x, y, z, w)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @return Vec2i
+--- Creates a Vec2i that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec2i_new(x, y)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @param z? integer
+--- @return Vec3i
+--- Creates a Vec3i that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec3i_new(x, y, z)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @param z? integer
+--- @param w? integer
+--- @return Vec4i
+--- Creates a Vec4i that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec4i_new(x, y, z, w)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @return Vec2s
+--- Creates a Vec2s that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec2s_new(x, y)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @param z? integer
+--- @return Vec3s
+--- Creates a Vec3s that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec3s_new(x, y, z)
+    -- ...
+end
+
+--- @param x? integer
+--- @param y? integer
+--- @param z? integer
+--- @param w? integer
+--- @return Vec4s
+--- Creates a Vec4s that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function vec4s_new(x, y, z, w)
+    -- ...
+end
+
+--- @param m00? number
+--- @param m01? number
+--- @param m02? number
+--- @param m03? number
+--- @param m10? number
+--- @param m11? number
+--- @param m12? number
+--- @param m13? number
+--- @param m20? number
+--- @param m21? number
+--- @param m22? number
+--- @param m23? number
+--- @param m30? number
+--- @param m31? number
+--- @param m32? number
+--- @param m33? number
+--- @return Mat4
+--- Creates a Mat4 that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function mat4_new(m00, m01, m02, m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33)
+    -- ...
+end
+
+--- @param r? integer
+--- @param g? integer
+--- @param b? integer
+--- @return Color
+--- Creates a Color that lives in Lua. Unset components are 0. Passing it to or from vector functions doesn't allocate
+function color_new(r, g, b)
+    -- ...
+end
+
 --- @alias Pointer_integer integer
 --- @alias Pointer_BehaviorScript BehaviorScript
 --- @alias Pointer_number number
@@ -1313,7 +1313,6 @@
 --- @field public localIndex integer
 --- @field public modelIndex integer
 --- @field public name string
---- @field public onRxSeqId integer
 --- @field public overrideLocation string
 --- @field public overrideModelIndex integer
 --- @field public overridePalette PlayerPalette
@@ -1322,6 +1321,7 @@
 --- @field public palette PlayerPalette
 --- @field public paletteIndex integer
 --- @field public ping integer
+--- @field public rxSeqHighest integer
 --- @field public type integer
 
 --- @class Object
@@ -0,0 +1 @@
+0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xde,0xf7,0xb5,0xad,0xb5,0xad,0xa5,0x29,0xde,0xf7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xb5,0xad,0xa5,0x29,0x94,0xa5,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xb5,0xad,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xb5,0xad,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xf7,0xc6,0x31,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xb5,0xad,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x6b,0x5b,0xc6,0x31,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xde,0xf7,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xde,0xf7,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0xc6,0x31,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xde,0xf7,0xc6,0x31,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xde,0xf7,0xb5,0xad,0xb5,0xad,0xc6,0x31,0xde,0xf7,0xef,0x7b,0xef,0x7b,0xef,0x7b,0xde,0xf7,0xc6,0x31,0xb5,0xad,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xde,0xf7,0x94,0xa5,0x94,0xa5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0xc6,0x31,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xde,0xf7,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0xde,0xf7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0xa5,0x29,0x94,0xa5,0x94,0xa5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xde,0xf7,0x7b,0xdf,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0xa5,0x29,0x94,0xa5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa5,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x94,0xa5,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xef,0x7b,0x4a,0x53,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x7b,0xdf,0x5a,0xd7,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0xde,0xf7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa5,0x4a,0x53,0x5a,0xd7,0x5a,0xd7,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xef,0x7b,0x7b,0xdf,0x4a,0x53,0x5a,0xd7,0x5a,0xd7,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0x5a,0xd7,0x5a,0xd7,0x94,0xa5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xde,0xf7,0x94,0xa5,0x7b,0xdf,0x94,0xa5,0x6b,0x5b,0x94,0xa5,0xde,0xf7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4
@@ -0,0 +1 @@
+0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x63,0x18,0x73,0x9c,0x73,0x9c,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x63,0x18,0xb5,0xac,0xe7,0x38,0xd6,0xb4,0xa5,0x28,0x73,0x9c,0x52,0x94,0x31,0x8c,0x32,0x10,0x42,0x10,0x73,0x9c,0xd6,0xb4,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0xa5,0x28,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xf7,0xbc,0xe7,0x38,0xd6,0xb5,0xe7,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x84,0x20,0xe7,0x38,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0xa5,0x28,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x63,0x1c,0xc6,0x2d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x63,0x18,0x84,0xa0,0xc6,0x31,0xf7,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x52,0x94,0x63,0x18,0x73,0xa0,0xa5,0x28,0xc6,0x35,0xf7,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x73,0x9c,0x84,0x20,0xa5,0x28,0xc6,0x31,0xe7,0x39,0xf7,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x63,0x18,0x84,0x20,0xa5,0x28,0xb5,0xb1,0xd6,0xb5,0xe6,0xb9,0xe7,0x39,0xe7,0x39,0xe7,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x62,0x98,0x84,0x20,0xa5,0x28,0xb6,0x30,0xc6,0x31,0xd6,0xb5,0xd6,0xb9,0xe7,0x39,0xe7,0x39,0xf7,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x73,0x9c,0xa4,0xa8,0xb5,0xac,0xb6,0x31,0xc6,0xb5,0xd6,0xb9,0xe7,0x3d,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x14,0x84,0x20,0xa5,0x28,0xb5,0xad,0xc6,0x31,0xd6,0xb9,0xe7,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x94,0xa4,0xa5,0xac,0xb6,0x31,0xc6,0xb5,0xd7,0x3d,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x31,0x8c,0x63,0x1c,0x95,0x28,0xa5,0x29,0xa5,0xb1,0xb6,0x35,0xd7,0x3d,0xe7,0xff,0xe7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x0c,0x21,0x08,0x31,0x90,0x63,0x18,0x94,0xa5,0xa5,0xad,0xa5,0xb1,0xb6,0x35,0xb7,0x3d,0xc7,0x3f,0xc7,0xbf,0xd7,0xff,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x08,0x31,0x8c,0x52,0x98,0x74,0x20,0x95,0x29,0xa5,0xb1,0xa6,0x35,0xa6,0x39,0xa6,0xb9,0xa6,0xbf,0xa6,0xbf,0xa7,0x3f,0xb7,0xbf,0xc7,0xff,0xd7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x0c,0x31,0x8c,0x52,0x94,0x84,0x20,0x94,0xa5,0xa5,0xad,0xa6,0x31,0x95,0xb5,0x95,0xb5,0x85,0xb5,0x75,0xb5,0x75,0xb5,0x75,0xb5,0x85,0xb5,0x86,0x35,0x96,0x39,0xa6,0xb9,0xc7,0x3d,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x73,0x9c,0x94,0xa4,0xa5,0x2d,0xa5,0xad,0x95,0xad,0x85,0xb1,0x85,0x31,0x75,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x75,0xb5,0x85,0xb5,0xa6,0xb9,0xc7,0x3d,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x41,0x8c,0x31,0x8c,0x42,0x10,0x52,0x94,0x73,0x9c,0x84,0x24,0x95,0x29,0x95,0x29,0x95,0x2d,0x85,0x2d,0x74,0xad,0x74,0xad,0x64,0xad,0x65,0x31,0x65,0x31,0x65,0x35,0x65,0xb5,0x75,0xb9,0x96,0xbd,0xb7,0x3f,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x10,0x63,0x18,0x73,0x9c,0x84,0x20,0x94,0xa4,0x95,0x29,0x94,0xa9,0x85,0x29,0x85,0x29,0x74,0xad,0x74,0xad,0x75,0x31,0x75,0xb5,0x65,0xb5,0x65,0xb9,0x76,0x39,0x86,0x39,0xa6,0xbf,0xc7,0xbf,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x42,0x10,0x62,0x94,0x73,0x9c,0x73,0xa0,0x84,0x20,0x94,0xa4,0xa5,0x29,0xa5,0x2d,0x95,0xad,0x95,0x2d,0x85,0xb1,0x85,0xb5,0x85,0xb5,0x75,0xb5,0x65,0xb5,0x75,0xb9,0x76,0x39,0x96,0xbd,0xb7,0x3f,0xd7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x41,0x8c,0x42,0x10,0x42,0x10,0x52,0x94,0x63,0x18,0x84,0x20,0x94,0xa9,0xb5,0xad,0xb5,0xb1,0xa5,0xb1,0xa6,0x35,0x96,0x35,0x96,0x39,0x85,0xb5,0x75,0xb9,0x76,0x39,0x86,0x39,0x86,0xbd,0x97,0x3f,0xb7,0xbf,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x63,0x18,0x84,0xa4,0xb5,0xad,0xc6,0xb5,0xc6,0xb5,0xb6,0xb5,0xb6,0xb5,0xa6,0x35,0x96,0x35,0x96,0x39,0x96,0xbd,0x96,0xbd,0x96,0xbd,0x96,0xbd,0xb7,0x3f,0xc7,0xbf,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x52,0x98,0x84,0x20,0xa5,0xad,0xc6,0x35,0xd6,0xb5,0xc6,0xb5,0xb6,0x35,0xa6,0x35,0xa6,0x35,0xa6,0xb9,0xb7,0xbf,0xc7,0xff,0xb7,0x3f,0xa7,0x3f,0xb7,0x3f,0xb7,0x3f,0xd7,0xff,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x73,0x9c,0x94,0xa4,0xb5,0xad,0xc6,0x31,0xb5,0xad,0xb6,0x31,0xc6,0xb9,0xc7,0x3d,0xd7,0xbf,0xd7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xf7,0xff,0xe7,0xff,0xd7,0xff,0xd7,0xbf,0xe7,0xff,0xf7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xff,0xff,0xf7,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x63,0x18,0x84,0x20,0xa5,0x28,0xb5,0xad,0xb5,0xad,0xc6,0xb5,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0x31,0x8c,0x42,0x10,0x63,0x18,0x84,0x20,0x94,0xa4,0xa5,0x29,0xb5,0xad,0xd6,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xd7,0xff,0xd7,0xff,0xd7,0xff,0xc7,0xff,0xc7,0xff,0xc7,0xff,0xd7,0xff,0xd7,0xff,0xe7,0xff,0x42,0x10,0x52,0x94,0x73,0x9c,0x84,0x20,0x94,0xa4,0xc6,0x31,0xf7,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xd7,0xff,0xd7,0xff,0xc7,0xff,0xc7,0xff,0xc7,0xff,0xd7,0xff,0xe7,0xff,0xe7,0xff,0x42,0x10,0x52,0x10,0x63,0x18,0x83,0xa0,0xc5,0xb0,0xff,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xd7,0xff,0xf7,0xff,0xf7,0xff,0xe7,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x84,0x20,0xd6,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfd,0xff,0xf9,0xff,0xfd,0xff,0xfd,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xf7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x73,0x9c,0xd6,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfd,0xff,0xf9,0xff,0xf9,0xff,0xf5,0xff,0xf9,0xff,0xf9,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x94,0xa4,0xd6,0xb5,0xf7,0xbd,0xe7,0x39,0xf7,0xb9,0xf7,0xbd,0xf7,0xfd,0xff,0xfd,0xff,0xff,0xff,0xfd,0xff,0xf9,0xff,0xf5,0xff,0xf5,0xff,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x63,0x18,0x94,0xa4,0xc5,0xb1,0xd6,0xb5,0xd6,0xb5,0xe7,0x39,0xf7,0xbd,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xf7,0xf5,0xf7,0xf5,0xff,0xf5,0xff,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x84,0x20,0xb5,0xad,0xd6,0xb5,0xe7,0x39,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf5,0xf7,0xf1,0xf7,0xf1,0xff,0xf5,0xff,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x52,0x94,0x84,0xa5,0xc6,0x31,0xe7,0x39,0xf7,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xf7,0xf1,0xf7,0xed,0xe7,0xe9,0xe7,0xed,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x31,0x8c,0x63,0x18,0xa5,0x29,0xe7,0x39,0xf7,0xfd,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfd,0xff,0xf9,0xff,0xf1,0xf7,0xed,0xe7,0xe9,0xe7,0xe5,0xe7,0xe5,0xff,0xed,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x32,0x10,0x84,0x20,0xe7,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xff,0xf5,0xff,0xf1,0xf7,0xed,0xf7,0xe9,0xe7,0xe5,0xd7,0xe5,0xe7,0xe5,0xf7,0xe9,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x42,0x10,0xa5,0x28,0xf7,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf5,0xf7,0xf1,0xf7,0xed,0xf7,0xe9,0xe7,0xe9,0xd7,0xe5,0xd7,0xa1,0xe7,0xe5,0xf7,0xe9,0xff,0xe9,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x31,0x8c,0x42,0x10,0xa5,0x28,0xe7,0x39,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xff,0xf1,0xf7,0xed,0xf7,0xe9,0xf7,0xe9,0xe7,0xe5,0xd7,0xa1,0xd7,0x9d,0xd7,0xe1,0xe7,0xe1,0xe7,0xe1,0xff,0xed,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x42,0x10,0x63,0x18,0xb5,0xad,0xf7,0xbd,0xff,0xff,0xff,0xfd,0xff,0xfd,0xff,0xf5,0xf7,0xed,0xf7,0xe9,0xe7,0xe5,0xe7,0xe5,0xe7,0xe1,0xd7,0x9d,0xc7,0x9d,0xc7,0x99,0xb7,0x99,0xb7,0x99,0xd7,0xe1,0xff,0xed,0xff,0xf5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0x20,0xc6,0x30,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xff,0xf1,0xf7,0xed,0xf7,0xe9,0xe7,0xe5,0xe7,0xe1,0xd7,0xdd,0xd7,0x9d,0xb7,0x99,0xb7,0x15,0xa6,0x15,0x96,0x15,0xc7,0x9d,0xe7,0xe5,0xf7,0xed,0xff,0xf5,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x30,0xd6,0xb4,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xfd,0xff,0xf5,0xff,0xf1,0xf7,0xed,0xf7,0xe9,0xe7,0xe5,0xe7,0xe1,0xd7,0xdd,0xd7,0xdd,0xc7,0x99,0xa7,0x15,0x85,0x91,0x85,0x91,0x96,0x15,0xc7,0x9d,0xd7,0xe5,0xe7,0xed,0xf7,0xf1,0xf7,0xf5,0xe7,0xf5,0xd7,0x31,0xf7,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x30,0xd6,0xb4,0xff,0xfd,0xff,0xfd,0xff,0xff,0xff,0xf9,0xff,0xf5,0xff,0xf1,0xff,0xed,0xf7,0xe9,0xf7,0xe5,0xe7,0xe5,0xe7,0xe1,0xe7,0xe1,0xd7,0xdd,0xc7,0x9d,0xa6,0x19,0x95,0x95,0x85,0x95,0x96,0x15,0xa6,0x1d,0xb6,0xa5,0xc7,0x25,0xc7,0x29,0xc6,0xa9,0xc6,0xad,0xf7,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb4,0xe7,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0xff,0xf5,0xff,0xf1,0xf7,0xed,0xe7,0xe9,0xf7,0xe9,0xe7,0xe9,0xf7,0xe9,0xff,0xe9,0xf7,0xe9,0xe7,0xe5,0xd7,0xe1,0xc7,0x9d,0xa6,0x99,0x96,0x19,0x85,0x95,0x85,0x19,0x85,0x19,0xa5,0xa1,0xc6,0xa9,0xd7,0xb1,0xf7,0xf5,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x38,0xf7,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xff,0xf5,0xe7,0xad,0xd7,0x2d,0xd7,0xa9,0xd7,0xa9,0xd7,0xa9,0xe7,0xed,0xe7,0xed,0xd7,0xa5,0xe7,0xe9,0xc7,0xa1,0xa6,0x19,0x85,0x15,0x74,0x95,0x74,0x95,0x85,0x19,0xa6,0x21,0xc6,0xa5,0xd7,0xad,0xe7,0xf1,0xf7,0xf5,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbc,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xff,0xf9,0xe7,0xb1,0xd7,0x2d,0xd6,0xad,0xd6,0xa9,0xc6,0xa9,0xc6,0xa5,0xc6,0xa9,0xa5,0xa1,0xb6,0x21,0xc6,0xa5,0xa6,0x1d,0x85,0x19,0x74,0x95,0x74,0x95,0x85,0x1d,0xa5,0xa1,0xb6,0x25,0xc6,0xa9,0xe7,0xad,0xf7,0xf1,0xff,0xf5,0xff,0xff,0xff,0xff,0xf7,0xf5,0xf7,0xbc,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0xb5,0xd7,0x31,0xc6,0xad,0xb5,0xa9,0xa5,0xa5,0x95,0x21,0x84,0x9d,0x74,0x19,0x95,0x1d,0xb6,0x21,0xa5,0xa1,0x84,0x99,0x74,0x99,0x85,0x1d,0x95,0xa1,0xa6,0x25,0xb6,0xa5,0xd7,0x2d,0xd7,0xad,0xe7,0xad,0xff,0xf5,0xff,0xf9,0xb6,0xa9,0xf7,0xbc,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xe7,0xb5,0xc6,0x2d,0xa5,0x25,0xa5,0x25,0x94,0xa1,0x84,0xa1,0xa5,0xa5,0xa5,0xa5,0x95,0xa1,0x84,0x19,0x74,0x19,0x84,0x9d,0xa5,0xa5,0xc6,0xa9,0xc6,0xad,0xc6,0xa9,0xc6,0xa9,0xd7,0x2d,0xe7,0xf1,0xe7,0xf1,0x74,0x18,0xf7,0xbc,0xe7,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x35,0xc6,0x31,0xb6,0x2d,0xb5,0xa9,0xa5,0x25,0x95,0x21,0x84,0x9d,0x74,0x19,0x74,0x19,0x74,0x19,0x84,0x9d,0xa5,0xa5,0xc6,0xad,0xc7,0x2d,0xc6,0xa9,0xb6,0x25,0xb6,0xa8,0xd7,0x2c,0xa6,0x24,0x31,0x88,0xf7,0xbc,0xb5,0xac,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbd,0xf7,0xbd,0xc6,0xb1,0xa5,0xa9,0x95,0x25,0x84,0x1d,0x84,0x1d,0x84,0x1d,0x84,0x1d,0x73,0x99,0x74,0x19,0x95,0x25,0xb6,0x29,0xc6,0xad,0xc6,0xa9,0xb6,0x29,0xa6,0x24,0xb6,0xa8,0x64,0x14,0x21,0x04,0xf7,0x38,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x39,0xc6,0x31,0xb5,0xa9,0xa5,0x25,0x84,0xa1,0x74,0x1d,0x63,0x19,0x63,0x15,0x84,0x21,0xc6,0x2d,0xd6,0xb1,0xc6,0xad,0xc6,0xad,0xb6,0x29,0xa5,0xa4,0x84,0x9c,0x32,0x0c,0x21,0x04,0xc5,0xb0,0xc6,0x30,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xb9,0xc6,0xb1,0x84,0x21,0x63,0x19,0x74,0x1d,0xb5,0xa9,0xd7,0x31,0xd7,0x31,0xd6,0xb1,0xc6,0xad,0xb6,0x28,0x74,0x18,0x32,0x0c,0x21,0x08,0x21,0x04,0xa5,0x28,0xe7,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xc6,0xb1,0xc6,0x2d,0xb6,0x2d,0xa5,0xa9,0x94,0xa1,0x84,0x1d,0x95,0x25,0xb6,0x29,0xb6,0xad,0xb6,0x29,0x94,0xa1,0x53,0x14,0x42,0x10,0x31,0x88,0x21,0x08,0x21,0x08,0x21,0x04,0xa5,0x28,0xd7,0x38,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xfd,0xd7,0x35,0xa5,0x25,0x95,0x25,0xa5,0xa5,0x95,0x25,0x84,0xa1,0x95,0x21,0xa5,0x25,0x95,0x25,0x84,0xa1,0x73,0x98,0x42,0x90,0x31,0x8c,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x94,0xa4,0xd6,0xb4,0xff,0xfe,0xf7,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbd,0xb5,0xac,0xa5,0x28,0xb5,0xac,0xb5,0xa8,0xb5,0xac,0xb5,0xa8,0x84,0xa0,0x63,0x98,0x63,0x18,0x53,0x14,0x53,0x14,0x63,0x18,0x74,0x1c,0x73,0x98,0x63,0x98,0x52,0x90,0x42,0x0c,0x31,0x8c,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x84,0x24,0xe7,0x38,0xf7,0xbc,0xf7,0xbd,0xff,0xff,0xff,0xff,0xf7,0xbd,0xa5,0xa8,0x63,0x18,0x42,0x10,0x42,0x90,0x42,0x90,0x52,0x94,0x42,0x10,0x32,0x0c,0x32,0x0c,0x42,0x0c,0x32,0x0c,0x42,0x0c,0x42,0x90,0x42,0x90,0x32,0x0c,0x31,0x88,0x21,0x88,0x21,0x88,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x94,0xa4,0xf7,0xbc,0xe7,0x38,0xe7,0x38,0xf7,0xbd,0xd6,0xb5,0xa5,0x28,0x63,0x18,0x31,0x8c,0x21,0x88,0x21,0x88,0x21,0x88,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x21,0x88,0x21,0x88,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0xa4,0xa8,0xe7,0x38,0xc5,0xb0,0xb6,0x2c,0xd6,0xb4,0x84,0x20,0x63,0x18,0x31,0x8c,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0xa4,0xa8,0xe7,0x38,0xc5,0xb0,0xb6,0x2c,0xd6,0xb4,0x84,0x20,0x63,0x18,0x31,0x8c,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08
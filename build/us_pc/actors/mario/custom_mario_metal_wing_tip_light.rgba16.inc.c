@@ -0,0 +1 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xc6,0x42,0x10,0x52,0x94,0x31,0x8c,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x39,0xce,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x18,0xc6,0x29,0x4a,0x39,0xce,0x42,0x10,0x52,0x94,0x63,0x18,0x63,0x18,0x63,0x18,0x52,0x94,0x31,0x8c,0x10,0x84,0x00,0x00,0x00,0x00,0x19,0x09,0x4a,0x53,0x29,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x44,0x29,0x4a,0x42,0x10,0x52,0x94,0x5a,0xd6,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x52,0x94,0x39,0xcf,0x42,0x13,0x63,0x19,0x4a,0x53,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x8d,0x39,0xcf,0x52,0x95,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x6b,0x5b,0x6b,0x5b,0x73,0x9d,0x63,0x5b,0x52,0x95,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x95,0x52,0x95,0x62,0xd9,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x19,0x6b,0x5b,0x73,0x9d,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x4a,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x5b,0x6b,0x5b,0x63,0x19,0x63,0x19,0x63,0x19,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x73,0x9d,0x73,0x9d,0x73,0x9d,0x73,0x9d,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x63,0x19,0x39,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xdf,0x73,0x9f,0x6b,0x5b,0x6b,0x5b,0x73,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xdf,0x7b,0xdf,0x73,0x9d,0x73,0x9d,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x73,0x5d,0x42,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x5b,0x73,0x9d,0x6b,0x9b,0x73,0x9d,0x73,0x9d,0x73,0x9d,0x73,0x9d,0x73,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x73,0x9d,0x52,0x95,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x5b,0x6b,0x5b,0x63,0x5b,0x63,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5d,0x6b,0x9d,0x73,0xdd,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5b,0x17,0x29,0x4b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x19,0x5a,0xd9,0x5a,0xd9,0x5a,0xd7,0x5a,0xd9,0x5a,0xd9,0x5b,0x19,0x5b,0x19,0x63,0x5b,0x6b,0x5d,0x73,0x9f,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x42,0x11,0x29,0x4a,0x10,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xd7,0x4a,0x95,0x4a,0x95,0x4a,0x95,0x4a,0x95,0x4a,0x97,0x4a,0x97,0x4a,0xd7,0x53,0x19,0x5b,0x5b,0x6b,0x5d,0x6b,0x9d,0x73,0x9d,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x63,0x19,0x42,0x11,0x18,0xc7,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xc6,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x55,0x42,0x53,0x42,0x53,0x3a,0x55,0x3a,0x55,0x3a,0x55,0x3a,0x55,0x3a,0x57,0x42,0x97,0x4a,0xd9,0x53,0x19,0x5b,0x19,0x63,0x1b,0x73,0x9f,0x73,0xdf,0x73,0xdf,0x6b,0x5b,0x5a,0xd9,0x42,0x53,0x29,0x4b,0x21,0x09,0x29,0x4b,0x39,0xcf,0x4a,0x53,0x5a,0xd7,0x63,0x19,0x5a,0xd7,0x39,0x8d,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x53,0x3a,0x13,0x32,0x13,0x32,0x15,0x2a,0x13,0x22,0x15,0x2a,0x57,0x32,0x57,0x32,0x55,0x32,0x13,0x32,0x55,0x3a,0x55,0x52,0xd9,0x6b,0x9d,0x73,0xdf,0x73,0x9d,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x63,0x19,0x52,0x95,0x6b,0x19,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x39,0xcf,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x13,0x32,0x13,0x2a,0x13,0x21,0xd3,0x11,0x91,0x11,0x93,0x11,0xd3,0x11,0xd3,0x11,0x91,0x11,0x4f,0x19,0x4f,0x2a,0x13,0x4a,0xd9,0x63,0x5d,0x6b,0x9d,0x6b,0x9d,0x63,0x5b,0x63,0x5b,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x08,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x11,0x29,0xd3,0x19,0xd3,0x09,0x91,0x01,0x0f,0x00,0xcd,0x00,0xcd,0x00,0xcd,0x01,0x0d,0x01,0x0d,0x09,0x4f,0x2a,0x15,0x3a,0xd9,0x53,0x1b,0x63,0x5d,0x63,0x5d,0x63,0x5b,0x6b,0x5b,0x6b,0x9d,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x4a,0x53,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x11,0x21,0xd1,0x11,0x8f,0x00,0xcd,0x00,0x8b,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x49,0x00,0xcf,0x09,0x93,0x1a,0x17,0x2a,0x57,0x3a,0x99,0x4b,0x1b,0x5b,0x5b,0x5b,0x1b,0x63,0x19,0x63,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x42,0x11,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xd1,0x19,0x91,0x01,0x0d,0x00,0x8b,0x00,0x49,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x4b,0x00,0xcf,0x01,0x53,0x01,0x51,0x11,0xd3,0x2a,0x55,0x32,0x57,0x42,0x97,0x4a,0xd9,0x5b,0x19,0x5b,0x19,0x63,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x73,0xdd,0x63,0x19,0x39,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x8f,0x11,0x4d,0x00,0xcb,0x00,0x89,0x00,0x49,0x00,0x05,0x00,0x05,0x00,0x07,0x00,0x09,0x00,0x8b,0x00,0x49,0x00,0x05,0x00,0x47,0x01,0x0d,0x11,0x4f,0x21,0xd1,0x3a,0x55,0x4a,0xd9,0x53,0x19,0x63,0x5b,0x6b,0x9d,0x73,0xdf,0x6b,0x5d,0x63,0x19,0x52,0xd7,0x52,0x95,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xc9,0x00,0x87,0x00,0x47,0x00,0x89,0x00,0x49,0x00,0x07,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x47,0x00,0xc9,0x11,0x4d,0x21,0xd1,0x3a,0x55,0x4a,0x97,0x63,0x5d,0x63,0x5b,0x52,0xd7,0x3a,0x11,0x31,0xcf,0x31,0x8d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x85,0x00,0x85,0x00,0x47,0x00,0x89,0x00,0x89,0x00,0x07,0x00,0x05,0x00,0x05,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0xc9,0x19,0x8f,0x21,0x8f,0x32,0x13,0x31,0xd1,0x29,0x8d,0x18,0xc9,0x08,0x85,0x08,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x85,0x00,0x87,0x00,0x87,0x00,0x89,0x00,0x89,0x00,0x47,0x00,0x07,0x00,0x05,0x00,0x07,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x89,0x00,0xc9,0x08,0xc9,0x08,0xc9,0x00,0x85,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x87,0x08,0x87,0x00,0x87,0x00,0x89,0x00,0xc9,0x00,0x49,0x00,0x07,0x00,0x05,0x00,0x09,0x00,0x09,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xc7,0x08,0xc9,0x08,0xc9,0x00,0x89,0x00,0x89,0x00,0x89,0x00,0x49,0x00,0x49,0x00,0x4b,0x00,0x09,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x09,0x11,0x0b,0x11,0x0b,0x01,0x0b,0x00,0x89,0x00,0x4b,0x00,0x4b,0x00,0x8d,0x00,0x4b,0x00,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x0b,0x09,0x0d,0x11,0x4d,0x09,0x4f,0x01,0x0f,0x00,0x8d,0x00,0x8d,0x00,0x8f,0x00,0x09,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x88,0x00,0x88,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcb,0x01,0x4f,0x09,0x91,0x09,0x93,0x01,0x53,0x01,0x13,0x00,0xd1,0x00,0x4f,0x00,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x01,0x0d,0x11,0x92,0x11,0xd4,0x00,0xcc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcd,0x01,0x4f,0x01,0x93,0x01,0x95,0x01,0x55,0x01,0x13,0x00,0x91,0x00,0x0b,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xcd,0x22,0x17,0x22,0x59,0x19,0xd4,0x00,0xca,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,0x01,0x53,0x01,0x95,0x01,0x55,0x01,0x13,0x00,0xd1,0x00,0x4d,0x00,0x09,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x89,0x22,0x15,0x32,0x99,0x2a,0x57,0x11,0x4f,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x53,0x01,0x55,0x01,0x55,0x01,0x13,0x00,0xd1,0x00,0x8f,0x00,0x0b,0x00,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0xcb,0x2a,0x15,0x42,0xdb,0x3a,0xd9,0x21,0xd1,0x00,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x55,0x01,0x53,0x01,0x13,0x00,0xd1,0x00,0x8f,0x00,0x4b,0x00,0x09,0x00,0x05,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x00,0x89,0x09,0x0d,0x2a,0x15,0x4b,0x1b,0x53,0x5d,0x42,0x97,0x19,0x0b,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x53,0x01,0x53,0x01,0x53,0x01,0x11,0x00,0xcf,0x00,0x8d,0x00,0x4b,0x00,0x07,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x47,0x00,0xcd,0x19,0x91,0x32,0x15,0x4a,0xd9,0x53,0x1b,0x53,0x19,0x3a,0x11,0x08,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x93,0x01,0x93,0x01,0x93,0x01,0x53,0x01,0x51,0x01,0x0f,0x00,0xcd,0x00,0xcb,0x00,0x8b,0x00,0xcb,0x00,0xcb,0x11,0x4f,0x2a,0x13,0x3a,0x55,0x3a,0x55,0x4a,0x97,0x52,0xd9,0x42,0x53,0x21,0x4b,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x51,0x09,0x95,0x11,0xd5,0x11,0xd5,0x09,0x93,0x09,0x93,0x09,0x91,0x09,0x51,0x11,0x91,0x19,0x91,0x29,0xd3,0x32,0x55,0x42,0x97,0x3a,0x13,0x31,0xd1,0x42,0x13,0x3a,0x11,0x29,0x4b,0x10,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x4f,0x11,0x91,0x1a,0x15,0x22,0x17,0x22,0x15,0x22,0x15,0x2a,0x15,0x2a,0x15,0x32,0x15,0x3a,0x57,0x42,0x97,0x4a,0xd9,0x4a,0x95,0x31,0xcf,0x31,0x8d,0x31,0x8d,0x29,0x4b,0x18,0xc6,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xcb,0x09,0x0d,0x19,0x91,0x21,0xd3,0x2a,0x15,0x32,0x55,0x3a,0x57,0x42,0x97,0x42,0x97,0x4a,0xd7,0x52,0xd9,0x52,0xd9,0x4a,0x53,0x39,0xcf,0x29,0x8d,0x21,0x4b,0x18,0xc6,0x10,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xc9,0x00,0x87,0x00,0xc9,0x08,0xc9,0x11,0x4d,0x21,0x8f,0x29,0xd1,0x32,0x11,0x42,0x53,0x4a,0x95,0x5b,0x19,0x63,0x19,0x5a,0xd7,0x4a,0x53,0x31,0x8c,0x18,0xc6,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x55,0x19,0x8f,0x08,0xc9,0x00,0x45,0x00,0x45,0x00,0x85,0x08,0xc7,0x21,0x4b,0x3a,0x13,0x5b,0x19,0x6b,0x9d,0x6b,0x9d,0x63,0x19,0x4a,0x52,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xd9,0x32,0x55,0x11,0x0b,0x00,0x45,0x00,0x01,0x00,0x01,0x08,0x87,0x29,0x8f,0x52,0xd9,0x6b,0x9d,0x7b,0xdf,0x73,0x9d,0x4a,0x53,0x18,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0xd7,0x21,0x8f,0x00,0x45,0x00,0x01,0x00,0x01,0x00,0x45,0x19,0x4b,0x31,0xd1,0x52,0xd7,0x6b,0x9d,0x63,0x19,0x31,0x8d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0x53,0x29,0x8f,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x85,0x19,0x4b,0x29,0x8d,0x31,0xcf,0x3a,0x11,0x18,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xcf,0x31,0xd1,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x85,0x19,0x09,0x29,0x8b,0x19,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x4b,0x21,0x4b,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x08,0xc5,0x10,0x85,0x08,0x82,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x49,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x49,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x0d,0x08,0xc3,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xc9,0x11,0x03,0x00,0x81,0x00,0x81,0x00,0x41,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
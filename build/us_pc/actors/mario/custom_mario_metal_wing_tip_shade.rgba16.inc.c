@@ -0,0 +1 @@
+0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x84,0x20,0x84,0x20,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x53,0x14,0x32,0x0c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x63,0x18,0xb5,0xac,0xff,0xfe,0xff,0xfe,0xd6,0xb4,0x94,0xa4,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x73,0x9c,0xd6,0xb4,0xd6,0xb4,0x73,0x9c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x63,0x18,0x73,0x9c,0x94,0xa4,0xb5,0xac,0xd6,0xb4,0xf7,0xbc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xd6,0xb4,0x94,0xa4,0x53,0x14,0x42,0x10,0x84,0x20,0xff,0xff,0xff,0xfe,0xff,0xfe,0xa5,0x28,0x41,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x52,0x94,0x84,0x20,0xc6,0x30,0xf7,0xbc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xe7,0x38,0xd6,0xb4,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0x73,0xa0,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xd6,0xb4,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xa5,0x24,0x41,0x90,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x63,0x18,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xfc,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb4,0x63,0x98,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x84,0x1c,0x41,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xe7,0x38,0x73,0x9c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xa5,0x28,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd7,0x38,0x94,0x20,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x63,0x18,0x84,0x20,0x42,0x10,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xc6,0x30,0x73,0x98,0x31,0x8c,0x32,0x0c,0x42,0x10,0x42,0x10,0x63,0x18,0xb6,0x2c,0xc6,0x30,0x63,0x18,0x42,0x10,0x42,0x10,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbd,0xb5,0xac,0x94,0xa4,0xa5,0x28,0xc6,0x30,0xe7,0x38,0xf7,0x38,0xff,0xfe,0xff,0xfe,0xe6,0xb9,0x73,0x9c,0x52,0x94,0x52,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x39,0x84,0xa4,0x63,0x18,0x63,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xbd,0x94,0xa4,0x52,0x94,0x52,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xac,0x73,0x9c,0x31,0x90,0x31,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xf7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xac,0x63,0x18,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xb7,0xff,0xc7,0xff,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xa4,0x42,0x10,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0xa7,0xff,0xb7,0xff,0xd7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb4,0x63,0x14,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xc7,0xff,0xa7,0xff,0xa7,0xbf,0x97,0xbf,0xa7,0xff,0xb7,0xff,0xb7,0xff,0xb7,0xff,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xa4,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xe7,0xff,0xe7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xbf,0x97,0xbf,0x97,0xbf,0x97,0x3f,0x86,0xbf,0x86,0xbd,0x96,0xbd,0xb7,0xbf,0xd7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbc,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xf7,0xff,0xf7,0xff,0xd7,0xff,0xb7,0xff,0xb7,0xff,0x97,0xbf,0x86,0xbf,0x76,0x3d,0x76,0x3d,0x76,0x39,0x86,0x39,0x96,0xbd,0xa7,0x3f,0xb7,0xbf,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x28,0x32,0x0c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xbf,0x97,0xbf,0x87,0x3f,0x76,0x3d,0x75,0xb9,0x75,0xb9,0x76,0x3d,0x96,0xbd,0xa7,0x3f,0xc7,0xbf,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xbf,0xc6,0x35,0x95,0x28,0x53,0x18,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xe7,0xff,0xd7,0xff,0xb7,0xff,0xa7,0xbf,0xa7,0xff,0x97,0xff,0x76,0xbf,0x65,0xb9,0x65,0xb9,0x76,0x3d,0x86,0x3d,0x97,0x3f,0xa7,0x3f,0xc7,0xbf,0xc7,0xbf,0xc7,0xbf,0xd7,0xbf,0xd7,0x3f,0xb6,0x35,0x94,0xa9,0x63,0x9c,0x42,0x94,0x31,0x8c,0x21,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x87,0xbf,0x66,0x3f,0x55,0x39,0x65,0xb9,0x65,0xbd,0x76,0x3d,0x86,0xbf,0xa7,0x3f,0xa6,0xbd,0xa6,0x39,0xa6,0x39,0xa6,0xb9,0x95,0xb1,0x85,0x28,0x74,0x24,0x63,0x9c,0x42,0x10,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x76,0xbf,0x55,0xbd,0x55,0xbd,0x55,0xbd,0x65,0xbd,0x76,0x3d,0x86,0xbd,0x96,0xbd,0x96,0x39,0x96,0x39,0x96,0x34,0x85,0x30,0x85,0x2c,0x85,0x2c,0x74,0x24,0x53,0x1c,0x42,0x14,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0x87,0xbf,0x66,0x3f,0x55,0xbd,0x55,0xbd,0x55,0xbd,0x65,0xbd,0x76,0x3d,0x86,0x3d,0x86,0x39,0x96,0x39,0xb7,0xbe,0xe7,0xfe,0xe7,0xfe,0xc7,0xbe,0x96,0x34,0x64,0x24,0x53,0x1c,0x32,0x14,0x21,0x8c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xc7,0xff,0xb7,0xff,0x97,0xff,0x77,0x3f,0x55,0xbf,0x55,0xbd,0x55,0xbd,0x55,0xbd,0x65,0xbd,0x76,0x3d,0x86,0x39,0x96,0xbd,0xb7,0x3f,0xf7,0xff,0xff,0xfe,0xff,0xfe,0xf7,0xfe,0xa6,0xb8,0x63,0xa0,0x42,0x98,0x31,0x90,0x21,0x8c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xe7,0xff,0xf7,0xff,0xff,0xff,0xf7,0xff,0xd7,0xff,0xb7,0xff,0x97,0xff,0x87,0xbf,0x66,0xbf,0x56,0x3f,0x55,0xbd,0x55,0xbd,0x55,0xbd,0x65,0xb9,0x86,0x3d,0x96,0xbd,0xa7,0x3f,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xf7,0xfe,0x85,0x30,0x43,0x18,0x31,0x90,0x21,0x8c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xe7,0xff,0xf7,0xff,0xf7,0xff,0xd7,0xff,0xb7,0xff,0xa7,0xff,0x97,0xff,0x77,0xbf,0x66,0x3f,0x65,0xbd,0x55,0xbd,0x65,0xbd,0x66,0x3d,0x86,0x3d,0x96,0xbd,0xb7,0xbf,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd7,0xfe,0x63,0xa0,0x21,0x8c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xe7,0xff,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x87,0xff,0x77,0x3f,0x66,0x3f,0x55,0xbd,0x55,0xbd,0x65,0xbd,0x76,0x3d,0xa7,0x3f,0xc7,0xbf,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb7,0x3c,0x32,0x14,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0xa7,0xff,0x97,0xff,0x87,0x3f,0x76,0xbf,0x76,0xbf,0x86,0xbf,0x97,0x3f,0xb7,0xbf,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xa5,0xb0,0x31,0x8c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xf7,0xff,0xe7,0xff,0xd7,0xff,0xd7,0xff,0xc7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0xa7,0xbf,0xb7,0xbf,0xb7,0xff,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x38,0x84,0x24,0x21,0x8c,0x21,0x0c,0x21,0x0c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xff,0xff,0xf7,0xff,0xf7,0xff,0xf7,0xff,0xf7,0xff,0xe7,0xff,0xe7,0xff,0xd7,0xff,0xe7,0xff,0xe7,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xb5,0xac,0x52,0x94,0x21,0x8c,0x21,0x8c,0x21,0x0c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0x21,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xe7,0x38,0x84,0x20,0x31,0x8c,0x31,0x8c,0x21,0x8c,0x21,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xa5,0x28,0x42,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xd6,0xb4,0x63,0x18,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xd7,0x34,0x73,0x9c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xf7,0xfc,0xc6,0x30,0x73,0x9c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xd7,0xbf,0xe7,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xc6,0x30,0x84,0x20,0x52,0x94,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0xb9,0xc6,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb4,0x73,0x9c,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xd7,0xbd,0x95,0x2d,0xd7,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb5,0xac,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xe7,0xbd,0x94,0xa9,0xa5,0xad,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb4,0x63,0x18,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xe7,0xbd,0x95,0x29,0xa5,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xa5,0xa8,0x42,0x10,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xe7,0x39,0xc6,0xb5,0xd6,0xb5,0xff,0xff,0xf7,0xfc,0xe7,0xb4,0xc6,0xb0,0xc6,0x2c,0x84,0x1c,0x32,0x0c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xd7,0x35,0xc6,0xb1,0xc6,0xb1,0xd7,0x31,0xb6,0x28,0x84,0xa0,0x74,0x1c,0x74,0x1c,0x52,0x94,0x31,0x8c,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xe7,0xf9,0xc7,0x31,0xb6,0x2d,0x95,0x25,0x63,0x98,0x53,0x14,0x52,0x90,0x42,0x90,0x31,0x8c,0x21,0x88,0x21,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xff,0xff,0xff,0xff,0xff,0xfd,0xf7,0xf9,0xf7,0xf9,0xd7,0xb1,0x63,0x94,0x42,0x90,0x32,0x0c,0x31,0x88,0x21,0x88,0x21,0x08,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xf7,0xf5,0xd7,0xb1,0xc7,0x2d,0xb6,0xa9,0xb6,0xa8,0x95,0x20,0x42,0x90,0x31,0x88,0x21,0x88,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0xb6,0xa9,0x95,0x21,0x84,0x9d,0x74,0x18,0x63,0x94,0x42,0x8c,0x21,0x88,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x74,0x18,0x32,0x0c,0x31,0x88,0x21,0x88,0x21,0x08,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x88,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x88,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x21,0x08,0x21,0x88,0x21,0x88,0x21,0x88,0x31,0x88,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c,0x31,0x8c
@@ -0,0 +1 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xcf,0x18,0x87,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x86,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x87,0x41,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x86,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x86,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0x41,0xce,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x87,0x08,0x03,0x18,0x87,0x41,0xcf,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0x41,0xce,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x41,0xcf,0x18,0x87,0x08,0x03,0x18,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xcf,0x08,0x03,0x18,0x87,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x18,0x87,0x08,0x03,0x41,0xcf,0x00,0x00,0x00,0x00,0x18,0x87,0x00,0x00,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x44,0xb7,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xc7,0x3d,0x41,0xcf,0x18,0x87,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x87,0x41,0xcf,0xc7,0x3d,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x44,0xb7,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x00,0x00,0x18,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x87,0x08,0x03,0x18,0x87,0x41,0xcf,0x08,0x03,0x08,0x03,0x44,0xb7,0x75,0xbb,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x75,0xbb,0x44,0xb7,0x08,0x03,0x08,0x03,0x41,0xcf,0x18,0x87,0x08,0x03,0x18,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x18,0x87,0x00,0x00,0x44,0xb7,0x08,0x03,0x08,0x03,0x44,0xb7,0x96,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x41,0xcf,0x18,0x87,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x87,0x41,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x96,0x7f,0x44,0xb7,0x08,0x03,0x08,0x03,0x44,0xb7,0x00,0x00,0x18,0x87,0x08,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x87,0x00,0x00,0x00,0x00,0x35,0xfd,0x08,0x03,0x08,0x03,0x75,0xbb,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x75,0xbb,0x08,0x03,0x08,0x03,0x35,0xfd,0x00,0x00,0x00,0x00,0x18,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x08,0x03,0x08,0x03,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x03,0x41,0xcf,0x08,0x02,0x08,0x02,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x08,0x03,0x08,0x03,0x35,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x18,0x87,0x08,0x03,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x18,0x87,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x03,0x41,0xcf,0x18,0x87,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x18,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x08,0x03,0x18,0x87,0x35,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x41,0xcf,0x08,0x03,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x87,0x08,0x03,0x08,0x03,0xff,0xff,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x02,0x08,0x02,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x08,0x03,0x08,0x03,0xff,0xff,0x08,0x03,0x08,0x03,0x18,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x08,0x03,0x41,0xcf,0x35,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x35,0xfd,0x08,0x03,0x75,0xbb,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x41,0xcf,0x08,0x03,0x08,0x03,0x41,0xcf,0x08,0x03,0x08,0x03,0x41,0xcf,0xff,0xff,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0xff,0xff,0x41,0xcf,0x08,0x03,0x08,0x03,0x41,0xcf,0x08,0x03,0x08,0x03,0x41,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x75,0xbb,0x08,0x03,0x35,0xfd,0x35,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x18,0x87,0x44,0xb7,0x96,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0xff,0xff,0xff,0xff,0xc7,0x3d,0x41,0xcf,0x08,0x03,0x41,0xcf,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x41,0xcf,0x08,0x03,0x41,0xcf,0xc7,0x3d,0xff,0xff,0xff,0xff,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x96,0x7f,0x44,0xb7,0x18,0x87,0x35,0xfd,0x66,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x41,0xcf,0x08,0x03,0x75,0xbb,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0xff,0xff,0xff,0xff,0x96,0x7f,0x75,0xbb,0x41,0xcf,0x66,0x7d,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x66,0x7d,0x41,0xcf,0x75,0xbb,0x96,0x7f,0xff,0xff,0xff,0xff,0x41,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x41,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x75,0xbb,0x08,0x03,0x41,0xcf,0x35,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x18,0x87,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x41,0xcf,0x18,0x87,0x41,0xcf,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x35,0xfd,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x35,0xfd,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0x41,0xcf,0x18,0x87,0x41,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x18,0x87,0x35,0xfd,0x66,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xfd,0x41,0xcf,0x18,0x87,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x41,0xcf,0x66,0x7d,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x66,0x7d,0x41,0xcf,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x18,0x87,0x41,0xcf,0x35,0xfd,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x41,0xcf,0x18,0x87,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x41,0xcf,0x66,0x7d,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x66,0x7d,0x41,0xcf,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x18,0x87,0x41,0xcf,0x35,0xfd,0x66,0x7d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x41,0xcf,0x18,0x87,0x44,0xb7,0x96,0x7f,0xc7,0x3d,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0xc7,0x3d,0x96,0x7f,0x96,0x7f,0x44,0xb7,0x41,0xcf,0x66,0x7d,0x41,0xce,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xce,0x66,0x7d,0x41,0xcf,0x44,0xb7,0x96,0x7f,0x96,0x7f,0xc7,0x3d,0xc7,0x3d,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x3d,0xc7,0x3d,0x96,0x7f,0x44,0xb7,0x18,0x87,0x41,0xcf,0x35,0xfd,0x66,0x7d,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x41,0xcf,0x18,0x87,0x41,0xcf,0x44,0xb7,0x75,0xbb,0x96,0x7f,0x96,0x7f,0x96,0x7f,0x75,0xbb,0x44,0xb7,0x41,0xcf,0x18,0x87,0x41,0xcf,0x66,0x7d,0x41,0xce,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xce,0x66,0x7d,0x41,0xcf,0x18,0x87,0x41,0xcf,0x44,0xb7,0x75,0xbb,0x96,0x7f,0x96,0x7f,0x96,0x7f,0x75,0xbb,0x44,0xb7,0x41,0xcf,0x18,0x87,0x41,0xcf,0x35,0xfd,0x66,0x7d,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x41,0xce,0x41,0xce,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x41,0xce,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x41,0xcf,0x18,0x87,0x08,0x03,0x08,0x03,0x08,0x03,0x18,0x87,0x41,0xcf,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xce,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x41,0xce,0x41,0xce,0x41,0xce,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x41,0xce,0x41,0xce,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x41,0xce,0x41,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
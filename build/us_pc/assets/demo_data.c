@@ -0,0 +1,36 @@
+#include "types.h"
+#include <stddef.h>
+#include "pc/rom_assets.h"
+
+struct DemoInputsObj {
+u32 numEntries;
+const void *addrPlaceholder;
+struct OffsetSizePair entries[7];
+u8 bbh[988];
+u8 ccm[1320];
+u8 hmc[980];
+u8 jrb[620];
+u8 wf[672];
+u8 pss[748];
+u8 unused[108];
+u8 bitdw[1412];
+} gDemoInputs = {
+7,
+NULL,
+{
+{offsetof(struct DemoInputsObj, bitdw), sizeof(gDemoInputs.bitdw)},
+{offsetof(struct DemoInputsObj, wf), sizeof(gDemoInputs.wf) + 368},
+{offsetof(struct DemoInputsObj, ccm), sizeof(gDemoInputs.ccm)},
+{offsetof(struct DemoInputsObj, bbh), sizeof(gDemoInputs.bbh)},
+{offsetof(struct DemoInputsObj, jrb), sizeof(gDemoInputs.jrb)},
+{offsetof(struct DemoInputsObj, hmc), sizeof(gDemoInputs.hmc)},
+{offsetof(struct DemoInputsObj, pss), sizeof(gDemoInputs.pss)},
+}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}
+};
+ROM_ASSET_LOAD_DEMO(bbh, gDemoInputs.bbh, 0x00579c60, 988, 0x00000000, 988);
+ROM_ASSET_LOAD_DEMO(ccm, gDemoInputs.ccm, 0x0057a03c, 1320, 0x00000000, 1320);
+ROM_ASSET_LOAD_DEMO(hmc, gDemoInputs.hmc, 0x0057a564, 980, 0x00000000, 980);
+ROM_ASSET_LOAD_DEMO(jrb, gDemoInputs.jrb, 0x0057a938, 620, 0x00000000, 620);
+ROM_ASSET_LOAD_DEMO(wf, gDemoInputs.wf, 0x0057aba4, 672, 0x00000000, 672);
+ROM_ASSET_LOAD_DEMO(pss, gDemoInputs.pss, 0x0057ae44, 748, 0x00000000, 748);
+ROM_ASSET_LOAD_DEMO(bitdw, gDemoInputs.bitdw, 0x0057b19c, 1412, 0x00000000, 1412);
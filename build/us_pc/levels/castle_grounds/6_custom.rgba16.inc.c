@@ -0,0 +1 @@
+0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x23,0x07,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x07,0x2c,0x47,0x2c,0x47,0x34,0x87,0x35,0x07,0x35,0x07,0x35,0x47,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x2c,0x47,0x2c,0x47,0x34,0x87,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x2c,0x47,0x34,0x87,0x34,0x87,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x87,0x2c,0x07,0x34,0x87,0x34,0x87,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x2b,0x87,0x2c,0x07,0x34,0x87,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x2b,0x87,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x2b,0x87,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x07,0x2b,0x47,0x2b,0xc7,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x07,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2b,0xc7,0x2c,0x07,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2b,0xc7,0x2c,0x07,0x2c,0x07,0x2c,0x47,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x2c,0x47,0x2c,0x47,0x34,0x87,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0x87,0x34,0x87,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x23,0x07,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0x87,0x34,0xc7,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x23,0x07,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x2b,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x87,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x87,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x87,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x47,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x07,0x23,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x3d,0xc7,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x22,0xc7,0x23,0x47,0x2b,0x47,0x2b,0x87,0x2b,0xc7,0x2c,0x07,0x2c,0x47,0x34,0x87,0x34,0xc7,0x35,0x07,0x35,0x07,0x35,0x47,0x35,0x87,0x35,0x87,0x3d,0xc7,0x3e,0x07,0x3e,0x07,0x3e,0x07,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47,0x3e,0x47
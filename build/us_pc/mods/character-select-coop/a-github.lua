@@ -0,0 +1,3 @@
+GITHUB_COMMIT_TIME = '05/16/2025 07:27:43 PM PST'
+GITHUB_COMMIT_ID = '115b65e'
+GITHUB_REPO = 'Squishy6094/character-select-coop'
@@ -0,0 +1,35 @@
+smlua_text_utils_course_acts_replace(COURSE_BOB, " 1 BOB-OMB ISLANDS", "BIG BOB-OMB'S SKY FORT", "TOP OF THE SUNKEN SHIP", "IN THE SIDE OF THE MOUNTAIN", "FIND THE 8 RED COINS", "DEEP DIVE IN THE CAGE", "SMASH THE CHAIN CHOMP'S ROCKS")
+smlua_text_utils_course_acts_replace(COURSE_WF, " 2 SKY LAND RESORT", "THE NEW WHOMP KING", "CLIMB THE WINDMILL", "THE FLYING STEPPING STONES", "FINDING THE PURPLE SWITCH", "RED COINS OF THE SKY", "BEHIND THE UNDERWATER GATE")
+smlua_text_utils_course_acts_replace(COURSE_JRB, " 3 PIRANHA PLANT POND", "CLIMB THE RUINS", "THE FLOODED CAVE", "8 RED COINS OF THE POND", "SHOOT TO THE TOWER TOP", "UNDERWATER METAL DASH", "THE OWL'S DINNER TIME")
+smlua_text_utils_course_acts_replace(COURSE_CCM, " 4 CHUCKYA HARBOR", "CLIMB TO THE HIGHEST POLE", "SWIM INTO THE FLOODED CAGE", "THE UNDERWATER MAZE", "BREAK INTO THE BUILDING", "THE CHUCKYA'S RED COINS", "THE OTHER ENTRANCE")
+smlua_text_utils_course_acts_replace(COURSE_BBH, " 5 GLOOMY GARDEN", "BIG BOO'S TOWER", "TOP OF THE RISKY WALKWAY", "THE SECRET TUNNEL", "THE LONE TREE", "HAUNTED RIDE FOR RED COINS", "CALM THE ANGRY EYE")
+smlua_text_utils_course_acts_replace(COURSE_HMC, " 6 COLORFUL CORAL CAVERNS", "DEEP DIVE THROUGH THE CORAL", "BOAT RIDE AMONG THE ROCKS", "BREAK THROUGH THE FLOOR", "PRECISION SWIMMING", "RED COINS OF THE DEEP", "THE 'X' MARKS THE SPOT")
+smlua_text_utils_course_acts_replace(COURSE_LLL, " 7 KOOPA CANYON", "THE ANGRY SUN'S PYRAMID CLIMB", "SANDY RACE WITH KOOPA THE QUICK", "ANCIENT TREASURE INSIDE THE PYRAMID", "8 ROCKY RED COINS", "GLIDE FROM THE QUICKSAND TORNADO", "SINKY SPIRAL CAVE")
+smlua_text_utils_course_acts_replace(COURSE_SSL, " 8 LARGE LEAF FOREST", "A BIG BUG PROBLEM", "SHINING DOWN FROM THE TREE TOPS", "QUICK LILY PAD HOP", "THE BEE'S TREASURE", "VINE-CLIMBING FOR 8 RED COINS", "THE MISSING STAR")
+smlua_text_utils_course_acts_replace(COURSE_DDD, " 9 MAD MUSICAL MESS", "THE PIANO-PLAYING THWOMPS", "MOUTH OF THE GIANT FLUTE", "TRICKY TAMBOURINE TRICK", "CRAZY NOTE CLIMB", "THE 8 MUSICAL RED COINS", "TO STRUM THE GUITAR...")
+smlua_text_utils_course_acts_replace(COURSE_SL, "10 MELTING SNOW PEAKS", "CHILLY LOOKOUT FIGHT", "THE SNOWMAN'S DEN", "ICY SHELL RIDE", "THE LOST PENGUIN", "CLIFF JUMPING FOR RED COINS", "GLIDE TO THE HIDDEN LEDGE")
+smlua_text_utils_course_acts_replace(COURSE_WDW, "11 COLOSSAL CANDY CLUTTER", "TUXIE RACE DOWN THE SLIDE", "TOP OF THE TOY TOWER", "DOOR-KNOCKING", "MOVING TARGET", "POLE-JUMPING", "PLAYFUL RED COINS")
+smlua_text_utils_course_acts_replace(COURSE_TTM, "12 CLOUDRAIL STATION", "SWINGING THROUGH THE CLOUDS", "PLATFORM RIDE TO THE CAGE", "FLUFFY CASTLE CLIMB", "THE FROZEN CLOUD", "THE GIANT THWOMP'S TREASURE", "AIRBORNE RED COINS")
+smlua_text_utils_course_acts_replace(COURSE_THI, "13 FATAL FLAME FALLS", "DEEP IN THE FLAMING CAVERNS", "CROSS THE LAVA LAKE", "METAL MARIO MELTDOWN", "CLIMB THE CENTRAL LOOKOUT", "BURNING RED COINS", "RISKY RIDE INTO THE VOLCANO")
+smlua_text_utils_course_acts_replace(COURSE_TTC, "14 BOB-OMB BATTLE FACTORY", "TOP OF THE FACTORY", "WALL KICK UP THE TOWER", "CAREFUL CRANE CLAMBER", "SWIRLY SUCTION WALL", "THE RUSTY RED COINS", "THE ENGINE LEAK")
+smlua_text_utils_course_acts_replace(COURSE_RR, "15 STARLIGHT RUNWAY", "FOLLOW THE GLITTERING PATH", "CLIMB THROUGH THE MACHINERY", "SHUTDOWN THE HANDROID", "AIM THE TURRET", "RED COINS IN THE CRATER", "IN THE CAGE")
+
+smlua_text_utils_secret_star_replace(COURSE_BITDW, "   BOWSER'S SLIPPERY SWAMP")
+smlua_text_utils_secret_star_replace(COURSE_BITFS, "   RETRO REMIX CASTLE")
+smlua_text_utils_secret_star_replace(COURSE_BITS, "   BOWSER'S RAINBOW RUMBLE")
+smlua_text_utils_secret_star_replace(COURSE_PSS, "   MUSHROOM MOUNTAIN TOWN")
+smlua_text_utils_secret_star_replace(COURSE_COTMC, "   CREEPY CAP CAVE")
+smlua_text_utils_secret_star_replace(COURSE_TOTWC, "   WINDY WING CAP WELL")
+smlua_text_utils_secret_star_replace(COURSE_VCUTM, "   PUZZLE OF THE VANISH CAP")
+smlua_text_utils_secret_star_replace(COURSE_WMOTR, "   HIDDEN PALACE FINALE")
+smlua_text_utils_secret_star_replace(COURSE_SA, "   SANDY SLIDE SECRET")
+smlua_text_utils_secret_star_replace(COURSE_CAKE_END, "   SECRET STARS")
+
+smlua_text_utils_castle_secret_stars_replace("   SECRET STARS")
+smlua_text_utils_extra_text_replace(0, "ONE OF THE SECRET STARS!")
+smlua_text_utils_extra_text_replace(1, "")
+smlua_text_utils_extra_text_replace(2, "")
+smlua_text_utils_extra_text_replace(3, "")
+smlua_text_utils_extra_text_replace(4, "")
+smlua_text_utils_extra_text_replace(5, "")
+smlua_text_utils_extra_text_replace(6, "")
\ No newline at end of file
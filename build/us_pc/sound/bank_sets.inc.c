@@ -0,0 +1 @@
+0x46,0x0,0x58,0x0,0x5A,0x0,0x5C,0x0,0x5E,0x0,0x60,0x0,0x62,0x0,0x64,0x0,0x66,0x0,0x68,0x0,0x6A,0x0,0x6D,0x0,0x6F,0x0,0x71,0x0,0x73,0x0,0x75,0x0,0x77,0x0,0x79,0x0,0x7B,0x0,0x7D,0x0,0x7F,0x0,0x81,0x0,0x83,0x0,0x85,0x0,0x87,0x0,0x89,0x0,0x8B,0x0,0x8D,0x0,0x8F,0x0,0x91,0x0,0x93,0x0,0x95,0x0,0x97,0x0,0x99,0x0,0x9B,0x0,0x11,0x2C,0x2B,0x29,0x28,0x27,0x26,0xA,0x9,0x8,0x7,0x6,0x5,0x4,0x3,0x2,0x1,0x0,0x1,0x22,0x1,0x11,0x1,0x22,0x1,0xE,0x1,0x13,0x1,0xF,0x1,0x12,0x1,0xB,0x1,0xD,0x2,0x21,0x10,0x1,0x14,0x1,0x15,0x1,0x16,0x1,0x17,0x1,0x18,0x1,0x12,0x1,0x19,0x1,0x1F,0x1,0x21,0x1,0x1A,0x1,0xE,0x1,0x1B,0x1,0x1A,0x1,0x1C,0x1,0x1D,0x1,0x25,0x1,0x14,0x1,0x20,0x1,0x1E,0x1,0x1B,0x1,0x1A,0x1,0x23,0x1,0x24,0x1,0x1B,0x0,0x0,0x0,
@@ -0,0 +1 @@
+0x3,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3F,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x44,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x64,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x82,0x0,0x0,0x0,0x0,0x0,0x0,0xB0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0x94,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x9E,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xF0,0xAB,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x1F,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xCB,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1D,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0xE8,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xFF,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x4,0x1,0x0,0x0,0x0,0x0,0x0,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x17,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x18,0x1,0x0,0x0,0x0,0x0,0x0,0x40,0xC,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x24,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0xA,0x0,0x0,0x0,0x0,0x0,0x0,0x50,0x2F,0x1,0x0,0x0,0x0,0x0,0x0,0x30,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x31,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x44,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x45,0x1,0x0,0x0,0x0,0x0,0x0,0x80,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0x4B,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x4C,0x1,0x0,0x0,0x0,0x0,0x0,0x90,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4F,0x1,0x0,0x0,0x0,0x0,0x0,0x70,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x5C,0x1,0x0,0x0,0x0,0x0,0x0,0xA0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x5F,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x66,0x1,0x0,0x0,0x0,0x0,0x0,0xC0,0xD,0x0,0x0,0x0,0x0,0x0,0x0,0xD0,0x73,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x37,0x0,0x0,0x0,0x0,0x0,0x0,0xC0,0xAB,0x1,0x0,0x0,0x0,0x0,0x0,0xE0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xA0,0xAC,0x1,0x0,0x0,0x0,0x0,0x0,0xD0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0xAD,0x1,0x0,0x0,0x0,0x0,0x0,0xB0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xAF,0x1,0x0,0x0,0x0,0x0,0x0,0xF0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0xB6,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xBE,0x1,0x0,0x0,0x0,0x0,0x0,0x60,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xC5,0x1,0x0,0x0,0x0,0x0,0x0,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0xC8,0x1,0x0,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xD3,0x60,0xD5,0x0,0xDB,0x7F,0xDD,0x78,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x0,0xB,0x2A,0xB0,0x1,0xB,0x2A,0xB0,0x2,0xB,0x2A,0xB0,0x3,0xB,0x2A,0xB0,0x4,0xB,0x2A,0xB0,0x5,0xB,0x2A,0xB0,0x6,0xB,0x2A,0xB0,0x7,0xB,0x2A,0xB0,0x8,0xB,0x93,0xB0,0x9,0xB,0x93,0xB0,0xA,0xB,0x93,0xB0,0xB,0xB,0x93,0xB0,0xC,0xB,0x93,0xB0,0xD,0xB,0x93,0xB0,0xE,0xB,0x93,0xB0,0xF,0xB,0x93,0xB0,0x10,0xB,0x3B,0xB0,0x11,0xB,0x3B,0xB0,0x12,0xB,0x3B,0xB0,0x13,0xB,0x3B,0xB0,0x14,0xB,0x3B,0xB0,0x15,0xB,0x3B,0xB0,0x16,0xB,0x3B,0xB0,0x17,0xB,0x3B,0xB0,0x18,0xB,0x4C,0xB0,0x19,0xB,0x4C,0xB0,0x1A,0xB,0x4C,0xB0,0x1B,0xB,0x4C,0xB0,0x1C,0xB,0xA6,0xB0,0x1D,0xB,0xA6,0xB0,0x1E,0xB,0xA6,0xB0,0x1F,0xB,0xA6,0xB0,0x20,0xB,0x5D,0xB0,0x21,0xB,0x5D,0xB0,0x22,0xB,0x5D,0xB0,0x23,0xB,0x5D,0xB0,0x24,0xB,0xB9,0xB0,0x25,0xB,0xB9,0xB0,0x26,0xB,0xB9,0xB0,0x27,0xB,0xB9,0xB0,0x28,0xB,0xEC,0xB0,0x29,0xB,0x4C,0xB0,0x2A,0xB,0x4C,0xB0,0x2B,0xB,0x4C,0xB0,0x2C,0xB,0x4C,0xB0,0x2D,0xB,0x5D,0xB0,0x2E,0xB,0x5D,0xB0,0x2F,0xB,0x5D,0xB0,0x30,0x1,0x3F,0xB0,0x31,0x1,0x3F,0xB0,0x32,0x1,0x3F,0xB0,0x33,0x1,0x3F,0xB0,0x34,0x1,0x3F,0xB0,0x35,0x1,0x3F,0xB0,0x36,0x1,0x3F,0xB0,0x37,0x1,0x3F,0xB0,0x38,0x4,0x90,0xB0,0x39,0x4,0x90,0xB0,0x3A,0x4,0x90,0xB0,0x3B,0x4,0x90,0xB0,0x3C,0x4,0x90,0xB0,0x3D,0x4,0x90,0xB0,0x3E,0x4,0x90,0xB0,0x3F,0x4,0x90,0xB0,0x40,0x7,0xDD,0xB0,0x41,0x7,0xDD,0xB0,0x42,0x7,0xDD,0xB0,0x43,0x7,0xDD,0xB0,0x44,0x7,0xDD,0xB0,0x45,0x7,0xDD,0xB0,0x46,0x7,0xDD,0xB0,0x47,0x7,0xDD,0xFD,0xCE,0x20,0xFB,0x1,0x39,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x1,0x75,0xFB,0x1,0x50,0xFE,0x80,0xF9,0x1,0x50,0xA0,0xA1,0xA2,0xCC,0x0,0x75,0x84,0xE4,0xFE,0x80,0xF9,0x1,0x68,0xFA,0x1,0x6F,0xFB,0x1,0x55,0x0,0xFA,0x1,0x5D,0xFB,0x1,0x50,0xA0,0xA1,0xA2,0xFB,0x1,0x50,0x1,0xFF,0x1,0xF3,0x1,0xE7,0x2,0xB,0x2,0x17,0x2,0x27,0x2,0x33,0x2,0x3F,0x2,0x4B,0x2,0x57,0x2,0x63,0x2,0x6F,0x2,0x7B,0x2,0x88,0x2,0x94,0x2,0xA2,0x2,0xB0,0x2,0xBD,0x3,0x1,0x2,0xC9,0x2,0xD5,0x2,0xE2,0x2,0xEF,0x3,0x4F,0x3,0x1,0x3,0xF,0x3,0x1F,0x3,0x2F,0x3,0x3D,0x3,0x4F,0x3,0x65,0x3,0x84,0x3,0xA0,0x3,0xAD,0x3,0xB9,0x3,0xBC,0x3,0xC9,0x2,0x27,0x2,0x33,0x2,0x3F,0x3,0xE2,0x1,0xE7,0x1,0xE7,0x2,0x17,0x2,0x17,0x2,0x17,0x3,0xEF,0x3,0xFB,0x4,0x7,0x4,0x13,0x4,0x1F,0x4,0x2B,0x4,0x38,0x4,0x44,0x4,0x67,0x4,0x77,0x4,0x84,0xC6,0xB,0xC1,0x0,0x90,0x1,0xEF,0xFF,0x67,0x14,0x7F,0xFF,0xC6,0xB,0xC1,0x1,0x90,0x1,0xFB,0xFF,0x67,0x18,0x7F,0xFF,0xC6,0xC,0xC1,0x9,0x90,0x2,0x7,0xFF,0x67,0x24,0x7F,0xFF,0xC6,0xC,0xC1,0x1,0x90,0x2,0x13,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xB,0xC1,0x4,0x90,0x2,0x1F,0xFF,0xC4,0x67,0x1E,0x7F,0x67,0x41,0x7F,0xFF,0xC6,0xB,0xC1,0x5,0x90,0x2,0x2F,0xFF,0x67,0x2B,0x7F,0xFF,0xC6,0xB,0xC1,0x6,0x90,0x2,0x3B,0xFF,0x67,0x1E,0x7F,0xFF,0xC6,0xB,0xC1,0x7,0x90,0x2,0x47,0xFF,0x67,0x1C,0x7F,0xFF,0xC6,0xB,0xC1,0x8,0x90,0x2,0x53,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xB,0xC1,0x9,0x90,0x2,0x5F,0xFF,0x67,0x44,0x7F,0xFF,0xC6,0xB,0xC1,0xA,0x90,0x2,0x6B,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xB,0xC1,0xB,0x90,0x2,0x77,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xB,0xC1,0xC,0x90,0x2,0x83,0xFF,0x67,0x80,0x85,0x7F,0xFF,0xC6,0xB,0xC1,0xD,0x90,0x2,0x90,0xFF,0x67,0x7F,0x7F,0xFF,0xC6,0xB,0xC1,0xE,0x90,0x2,0x9C,0xFF,0xC2,0xFE,0x67,0x60,0x40,0xFF,0xC6,0xB,0xC1,0xF,0x90,0x2,0xAA,0xFF,0xC2,0xFE,0x67,0x5C,0x34,0xFF,0xC6,0xC,0xC1,0x0,0x90,0x2,0xB8,0xFF,0x67,0x80,0xAA,0x7F,0xFF,0xC6,0xB,0xC1,0x3,0x90,0x2,0xC5,0xFF,0x67,0x4D,0x7F,0xFF,0xC6,0xC,0xC1,0x6,0x90,0x2,0xD1,0xFF,0x67,0x28,0x7F,0xFF,0xC6,0xC,0xC1,0x5,0x90,0x2,0xDD,0xFF,0x67,0x80,0xC8,0x7F,0xFF,0xC6,0xC,0xC1,0x4,0x90,0x2,0xEA,0xFF,0x67,0x80,0x8C,0x7F,0xFF,0xC6,0xC,0xC1,0x2,0x90,0x2,0xF7,0xFF,0xC2,0xFE,0xC7,0x82,0x23,0xFF,0x66,0x30,0x7F,0xFF,0xC6,0xC,0xC1,0x2,0x90,0x3,0x9,0xFF,0xC2,0xFE,0x67,0x3C,0x64,0xFF,0xC6,0xC,0xC1,0x2,0x90,0x3,0x17,0xFF,0xC2,0xFE,0xC0,0x4,0x66,0x3C,0x64,0xFF,0xC6,0xC,0xC1,0x2,0x90,0x3,0x27,0xFF,0xC2,0xFE,0xC0,0x8,0x68,0x3C,0x64,0xFF,0xC6,0xC,0xC1,0x7,0x90,0x3,0x37,0xFF,0xC2,0xFE,0x67,0x10,0x73,0xFF,0xC6,0xC,0xC1,0x7,0x90,0x3,0x45,0xFF,0xC2,0xFE,0xC7,0x81,0x26,0xFF,0x69,0x18,0x73,0xFF,0xC6,0xC,0xC1,0x7,0x90,0x3,0x57,0xFF,0xC2,0xFE,0xC4,0xC7,0x85,0x26,0xFF,0x69,0xC,0x73,0x63,0x12,0x73,0xFF,0xC6,0xC,0xC1,0x9,0x90,0x3,0x81,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x3,0x79,0xFF,0xC7,0x81,0x2E,0xFF,0x67,0xF,0x7F,0xFF,0xFB,0x2,0x7,0xC6,0xC,0xC1,0xA,0x90,0x3,0x9C,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x3,0x98,0xFF,0x67,0x12,0x7F,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xC,0xC1,0xB,0x90,0x3,0xA8,0xFF,0x67,0x80,0x8C,0x7F,0xFF,0xC6,0xC,0xC1,0xC,0x90,0x3,0xB5,0xFF,0x67,0x60,0x7F,0xFF,0xFB,0x2,0x3F,0xC6,0xC,0xC1,0xD,0x90,0x3,0xC4,0xFF,0x67,0x80,0x91,0x7F,0xFF,0xC6,0xB,0xC1,0x1,0x90,0x3,0xDF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x3,0xDD,0xFF,0xC2,0x1,0xFB,0x1,0xFB,0xC6,0xC,0xC1,0xF,0x90,0x3,0xEA,0xFF,0x67,0x82,0xBC,0x7F,0xFF,0xC6,0xB,0xC1,0x18,0x90,0x3,0xF7,0xFF,0x67,0x5A,0x7F,0xFF,0xC6,0xB,0xC1,0x19,0x90,0x4,0x3,0xFF,0x67,0x5A,0x7F,0xFF,0xC6,0xB,0xC1,0x10,0x90,0x4,0xF,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0xB,0xC1,0x11,0x90,0x4,0x1B,0xFF,0x67,0x55,0x7F,0xFF,0xC6,0xB,0xC1,0x12,0x90,0x4,0x27,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0xB,0xC1,0x13,0x90,0x4,0x33,0xFF,0x67,0x81,0x2C,0x7F,0xFF,0xC6,0xB,0xC1,0x14,0x90,0x4,0x40,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xB,0x90,0x4,0x4A,0xFF,0xC0,0x4E,0xF8,0x32,0xFC,0x4,0x5C,0xF7,0xC6,0x15,0x67,0x84,0x4C,0x7F,0xFB,0x4,0x4C,0xFF,0xC6,0x15,0x65,0x53,0x7F,0xC6,0xF,0x65,0x4E,0x40,0xFF,0xC6,0xB,0xC1,0x16,0x90,0x4,0x72,0x91,0x4,0x72,0xFF,0x67,0x80,0xC8,0x7F,0xFF,0xC6,0xB,0xC1,0x17,0x90,0x4,0x7F,0xFF,0x67,0x80,0x96,0x7F,0xFF,0xC6,0xB,0xC1,0x1A,0x90,0x4,0x8C,0xFF,0x67,0x46,0x7F,0xFF,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x4,0xC6,0xFB,0x4,0xA1,0xFE,0x80,0xF9,0x4,0xA1,0xA0,0xA1,0xA2,0xCC,0x0,0x75,0x84,0xE4,0xFE,0x80,0xF9,0x4,0xB9,0xFA,0x4,0xC0,0xFB,0x4,0xA6,0x0,0xFA,0x4,0xAE,0xFB,0x4,0xA1,0xA0,0xA1,0xA2,0xFB,0x4,0xA1,0x5,0x50,0x5,0x44,0x5,0x38,0x5,0x60,0x5,0x6C,0x5,0x79,0x5,0x85,0x5,0x91,0x5,0x9D,0x5,0xA9,0x5,0xB5,0x5,0xC1,0x5,0xCD,0x5,0xDA,0x5,0xE7,0x5,0xF4,0x6,0x1,0x6,0xE,0x6,0x53,0x6,0x1B,0x6,0x28,0x6,0x34,0x6,0x41,0x6,0xA1,0x6,0x53,0x6,0x61,0x6,0x71,0x6,0x81,0x6,0x8F,0x6,0xA1,0x6,0xB7,0x6,0xD2,0x6,0xEF,0x6,0xFC,0x7,0x9,0x7,0xC,0x7,0x19,0x5,0x79,0x5,0x85,0x5,0x91,0x7,0x30,0x5,0x38,0x5,0x38,0x5,0x6C,0x5,0x6C,0x5,0x6C,0x7,0x3C,0x7,0x49,0x7,0x56,0x7,0x62,0x7,0x6F,0x7,0x7B,0x7,0x88,0x7,0x94,0x7,0xB7,0x7,0xC4,0x7,0xD1,0xC6,0xD,0xC1,0x0,0x90,0x5,0x40,0xFF,0x67,0x61,0x7F,0xFF,0xC6,0xD,0xC1,0x1,0x90,0x5,0x4C,0xFF,0x67,0x34,0x7F,0xFF,0xC6,0xE,0xC1,0x9,0x90,0x5,0x58,0xFF,0x67,0x4D,0x7F,0xFF,0x67,0x24,0x7F,0xFF,0xC6,0xE,0xC1,0x1,0x90,0x5,0x68,0xFF,0x67,0x6E,0x7F,0xFF,0xC6,0xD,0xC1,0x4,0x90,0x5,0x74,0xFF,0x67,0x80,0xB8,0x7F,0xFF,0xC6,0xD,0xC1,0x5,0x90,0x5,0x81,0xFF,0x67,0x27,0x7F,0xFF,0xC6,0xD,0xC1,0x6,0x90,0x5,0x8D,0xFF,0x67,0x3F,0x7F,0xFF,0xC6,0xD,0xC1,0x7,0x90,0x5,0x99,0xFF,0x67,0x74,0x7F,0xFF,0xC6,0xD,0xC1,0x8,0x90,0x5,0xA5,0xFF,0x67,0x4C,0x7F,0xFF,0xC6,0xD,0xC1,0x9,0x90,0x5,0xB1,0xFF,0x67,0x43,0x7F,0xFF,0xC6,0xD,0xC1,0xA,0x90,0x5,0xBD,0xFF,0x67,0x33,0x7F,0xFF,0xC6,0xD,0xC1,0xB,0x90,0x5,0xC9,0xFF,0x67,0x3C,0x7F,0xFF,0xC6,0xD,0xC1,0xC,0x90,0x5,0xD5,0xFF,0x67,0x80,0xBF,0x7F,0xFF,0xC6,0xD,0xC1,0xD,0x90,0x5,0xE2,0xFF,0x67,0x81,0x4C,0x7F,0xFF,0xC6,0xD,0xC1,0xE,0x90,0x5,0xEF,0xFF,0x67,0x80,0xCE,0x7F,0xFF,0xC6,0xD,0xC1,0xF,0x90,0x5,0xFC,0xFF,0x67,0x80,0xA1,0x7F,0xFF,0xC6,0xE,0xC1,0x0,0x90,0x6,0x9,0xFF,0x67,0x81,0x21,0x7F,0xFF,0xC6,0xD,0xC1,0x3,0x90,0x6,0x16,0xFF,0x67,0x81,0x59,0x7F,0xFF,0xC6,0xE,0xC1,0x6,0x90,0x6,0x23,0xFF,0x67,0x80,0x9B,0x7F,0xFF,0xC6,0xE,0xC1,0x5,0x90,0x6,0x30,0xFF,0x67,0x34,0x7F,0xFF,0xC6,0xE,0xC1,0x4,0x90,0x6,0x3C,0xFF,0x67,0x80,0xE5,0x7F,0xFF,0xC6,0xE,0xC1,0x2,0x90,0x6,0x49,0xFF,0xC2,0xFE,0xC7,0x82,0x23,0xFF,0x66,0x30,0x7F,0xFF,0xC6,0xE,0xC1,0x2,0x90,0x6,0x5B,0xFF,0xC2,0xFE,0x67,0x3C,0x64,0xFF,0xC6,0xE,0xC1,0x2,0x90,0x6,0x69,0xFF,0xC2,0xFE,0xC0,0x4,0x66,0x3C,0x64,0xFF,0xC6,0xE,0xC1,0x2,0x90,0x6,0x79,0xFF,0xC2,0xFE,0xC0,0x8,0x68,0x3C,0x64,0xFF,0xC6,0xE,0xC1,0x7,0x90,0x6,0x89,0xFF,0xC2,0xFE,0x67,0x10,0x73,0xFF,0xC6,0xE,0xC1,0x7,0x90,0x6,0x97,0xFF,0xC2,0xFE,0xC7,0x81,0x26,0xFF,0x69,0x18,0x73,0xFF,0xC6,0xE,0xC1,0x7,0x90,0x6,0xA9,0xFF,0xC2,0xFE,0xC4,0xC7,0x85,0x26,0xFF,0x69,0xC,0x73,0x63,0x12,0x73,0xFF,0xC6,0xE,0xC1,0x9,0x90,0x6,0xCF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x6,0xCB,0xFF,0x67,0xF,0x7F,0xFF,0xFB,0x5,0x5C,0xC6,0xE,0xC1,0xA,0x90,0x6,0xEA,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x6,0xE6,0xFF,0x67,0x12,0x7F,0xFF,0x67,0x80,0xA3,0x7F,0xFF,0xC6,0xE,0xC1,0xB,0x90,0x6,0xF7,0xFF,0x67,0x80,0xD9,0x7F,0xFF,0xC6,0xE,0xC1,0xC,0x90,0x7,0x4,0xFF,0x67,0x81,0x33,0x7F,0xFF,0xFB,0x5,0x91,0xC6,0xE,0xC1,0xD,0x90,0x7,0x14,0xFF,0x67,0x80,0xF4,0x7F,0xFF,0xC6,0xD,0xC1,0x1,0x90,0x7,0x2D,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x7,0x2D,0xFF,0xFB,0x5,0x4C,0xC6,0xE,0xC1,0xF,0x90,0x7,0x38,0xFF,0x67,0x3B,0x7F,0xFF,0xC6,0xD,0xC1,0x18,0x90,0x7,0x44,0xFF,0x67,0x80,0x95,0x7F,0xFF,0xC6,0xD,0xC1,0x19,0x90,0x7,0x51,0xFF,0x67,0x80,0xA2,0x7F,0xFF,0xC6,0xD,0xC1,0x10,0x90,0x7,0x5E,0xFF,0x67,0x2E,0x7F,0xFF,0xC6,0xD,0xC1,0x11,0x90,0x7,0x6A,0xFF,0x67,0x80,0xAB,0x7F,0xFF,0xC6,0xD,0xC1,0x12,0x90,0x7,0x77,0xFF,0x67,0x50,0x7F,0xFF,0xC6,0xD,0xC1,0x13,0x90,0x7,0x83,0xFF,0x67,0x80,0x9C,0x7F,0xFF,0xC6,0xD,0xC1,0x14,0x90,0x7,0x90,0xFF,0x67,0x6D,0x7F,0xFF,0xC6,0xD,0x90,0x7,0x9A,0xFF,0xC0,0x4E,0xF8,0x32,0xFC,0x7,0xAC,0xF7,0xC6,0x15,0x67,0x84,0x4C,0x7F,0xFB,0x7,0x9C,0xFF,0xC6,0x15,0x67,0x53,0x7F,0xC6,0xF,0x67,0x4E,0x7F,0xFF,0xC6,0xD,0xC1,0x16,0x90,0x7,0xBF,0xFF,0x67,0x80,0xC0,0x7F,0xFF,0xC6,0xD,0xC1,0x17,0x90,0x7,0xCC,0xFF,0x67,0x80,0xE1,0x7F,0xFF,0xC6,0xD,0xC1,0x1A,0x90,0x7,0xD9,0xFF,0x67,0x5A,0x7F,0xFF,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x8,0x13,0xFB,0x7,0xEE,0xFE,0x80,0xF9,0x7,0xEE,0xA0,0xA1,0xA2,0xCC,0x0,0x75,0x84,0xE4,0xFE,0x80,0xF9,0x8,0x6,0xFA,0x8,0xD,0xFB,0x7,0xF3,0x0,0xFA,0x7,0xFB,0xFB,0x7,0xEE,0xA0,0xA1,0xA2,0xFB,0x7,0xEE,0x8,0x9D,0x8,0x91,0x8,0x85,0x8,0xA9,0x8,0xB5,0x8,0xC5,0x8,0xD1,0x8,0xDD,0x8,0xE9,0x8,0xF5,0x9,0x1,0x9,0xD,0x9,0x19,0x9,0x26,0x9,0x32,0x9,0x3E,0x9,0x4A,0x9,0x57,0x9,0x9B,0x9,0x63,0x9,0x6F,0x9,0x7C,0x9,0x89,0x9,0xE9,0x9,0x9B,0x9,0xA9,0x9,0xB9,0x9,0xC9,0x9,0xD7,0x9,0xE9,0x9,0xFF,0xA,0x1E,0xA,0x3A,0xA,0x47,0xA,0x53,0xA,0x56,0xA,0x63,0x8,0xC5,0x8,0xD1,0x8,0xDD,0xA,0x7C,0x8,0x85,0x8,0x85,0x8,0xB5,0x8,0xB5,0x8,0xB5,0xA,0x89,0xA,0x95,0xA,0xA1,0xA,0xAD,0xA,0xB9,0xA,0xC5,0xA,0xD2,0xA,0xDE,0xB,0x1,0xB,0x11,0xB,0x1E,0xC6,0xF,0xC1,0x0,0x90,0x8,0x8D,0xFF,0x67,0x14,0x7F,0xFF,0xC6,0xF,0xC1,0x1,0x90,0x8,0x99,0xFF,0x67,0x18,0x7F,0xFF,0xC6,0x10,0xC1,0x9,0x90,0x8,0xA5,0xFF,0x67,0x24,0x7F,0xFF,0xC6,0x10,0xC1,0x1,0x90,0x8,0xB1,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xF,0xC1,0x4,0x90,0x8,0xBD,0xFF,0xC4,0x67,0x1E,0x7F,0x67,0x41,0x7F,0xFF,0xC6,0xF,0xC1,0x5,0x90,0x8,0xCD,0xFF,0x67,0x2B,0x7F,0xFF,0xC6,0xF,0xC1,0x6,0x90,0x8,0xD9,0xFF,0x67,0x1E,0x7F,0xFF,0xC6,0xF,0xC1,0x7,0x90,0x8,0xE5,0xFF,0x67,0x1C,0x7F,0xFF,0xC6,0xF,0xC1,0x8,0x90,0x8,0xF1,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xF,0xC1,0x9,0x90,0x8,0xFD,0xFF,0x67,0x44,0x7F,0xFF,0xC6,0xF,0xC1,0xA,0x90,0x9,0x9,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xF,0xC1,0xB,0x90,0x9,0x15,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xF,0xC1,0xC,0x90,0x9,0x21,0xFF,0x67,0x80,0x85,0x7F,0xFF,0xC6,0xF,0xC1,0xD,0x90,0x9,0x2E,0xFF,0x67,0x7F,0x7F,0xFF,0xC6,0xF,0xC1,0xE,0x90,0x9,0x3A,0xFF,0x67,0x60,0x7F,0xFF,0xC6,0xF,0xC1,0xF,0x90,0x9,0x46,0xFF,0x67,0x5C,0x7F,0xFF,0xC6,0x10,0xC1,0x0,0x90,0x9,0x52,0xFF,0x67,0x80,0xAA,0x7F,0xFF,0xC6,0xF,0xC1,0x3,0x90,0x9,0x5F,0xFF,0x67,0x4D,0x7F,0xFF,0xC6,0x10,0xC1,0x6,0x90,0x9,0x6B,0xFF,0x67,0x1E,0x7F,0xFF,0xC6,0x10,0xC1,0x5,0x90,0x9,0x77,0xFF,0x67,0x80,0xC8,0x7F,0xFF,0xC6,0x10,0xC1,0x4,0x90,0x9,0x84,0xFF,0x67,0x80,0x8C,0x7F,0xFF,0xC6,0x10,0xC1,0x2,0x90,0x9,0x91,0xFF,0xC2,0xFE,0xC7,0x82,0x23,0xFF,0x66,0x30,0x7F,0xFF,0xC6,0x10,0xC1,0x2,0x90,0x9,0xA3,0xFF,0xC2,0xFE,0x67,0x3C,0x64,0xFF,0xC6,0x10,0xC1,0x2,0x90,0x9,0xB1,0xFF,0xC2,0xFE,0xC0,0x4,0x66,0x3C,0x64,0xFF,0xC6,0x10,0xC1,0x2,0x90,0x9,0xC1,0xFF,0xC2,0xFE,0xC0,0x8,0x68,0x3C,0x64,0xFF,0xC6,0x10,0xC1,0x7,0x90,0x9,0xD1,0xFF,0xC2,0xFE,0x67,0x10,0x73,0xFF,0xC6,0x10,0xC1,0x7,0x90,0x9,0xDF,0xFF,0xC2,0xFE,0xC7,0x81,0x26,0xFF,0x69,0x18,0x73,0xFF,0xC6,0x10,0xC1,0x7,0x90,0x9,0xF1,0xFF,0xC2,0xFE,0xC4,0xC7,0x85,0x26,0xFF,0x69,0xC,0x73,0x63,0x12,0x73,0xFF,0xC6,0x10,0xC1,0x9,0x90,0xA,0x1B,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0xA,0x13,0xFF,0xC7,0x81,0x2E,0xFF,0x67,0xF,0x7F,0xFF,0xFB,0x8,0xA5,0xC6,0x10,0xC1,0xA,0x90,0xA,0x36,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0xA,0x32,0xFF,0x67,0x12,0x7F,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0x10,0xC1,0xB,0x90,0xA,0x42,0xFF,0x67,0x80,0x8C,0x7F,0xFF,0xC6,0x10,0xC1,0xC,0x90,0xA,0x4F,0xFF,0x67,0x60,0x7F,0xFF,0xFB,0x8,0xDD,0xC6,0x10,0xC1,0xD,0x90,0xA,0x5E,0xFF,0x67,0x80,0x91,0x7F,0xFF,0xC6,0xF,0xC1,0x1,0x90,0xA,0x79,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0xA,0x77,0xFF,0xC2,0x1,0xFB,0x8,0x99,0xC6,0x10,0xC1,0xF,0x90,0xA,0x84,0xFF,0x67,0x82,0xBC,0x7F,0xFF,0xC6,0xF,0xC1,0x18,0x90,0xA,0x91,0xFF,0x67,0x5A,0x7F,0xFF,0xC6,0xF,0xC1,0x19,0x90,0xA,0x9D,0xFF,0x67,0x5A,0x7F,0xFF,0xC6,0xF,0xC1,0x10,0x90,0xA,0xA9,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0xF,0xC1,0x11,0x90,0xA,0xB5,0xFF,0x67,0x55,0x7F,0xFF,0xC6,0xF,0xC1,0x12,0x90,0xA,0xC1,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0xF,0xC1,0x13,0x90,0xA,0xCD,0xFF,0x67,0x81,0x2C,0x7F,0xFF,0xC6,0xF,0xC1,0x14,0x90,0xA,0xDA,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0xF,0x90,0xA,0xE4,0xFF,0xC0,0x4E,0xF8,0x32,0xFC,0xA,0xF6,0xF7,0xC6,0x15,0x67,0x84,0x4C,0x7F,0xFB,0xA,0xE6,0xFF,0xC6,0x15,0x67,0x53,0x7F,0xC6,0xF,0x67,0x4E,0x7F,0xFF,0xC6,0xF,0xC1,0x16,0x90,0xB,0xC,0x91,0xB,0xC,0xFF,0x67,0x80,0xC8,0x7F,0xFF,0xC6,0xF,0xC1,0x17,0x90,0xB,0x19,0xFF,0x67,0x80,0x96,0x7F,0xFF,0xC6,0xF,0xC1,0x1A,0x90,0xB,0x26,0xFF,0x67,0x5A,0x7F,0xFF,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0xC,0x47,0xFB,0xB,0x6E,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x16,0xAF,0xFB,0xB,0x6E,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x1A,0x89,0xFB,0xB,0x6E,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x29,0x49,0xFB,0xB,0x6E,0xFE,0x80,0xF9,0xB,0x6E,0xA0,0xA1,0xA2,0xCC,0x0,0x75,0x84,0xE4,0xFE,0x80,0xF9,0xB,0x86,0xFA,0xB,0x8D,0xFB,0xB,0x73,0x0,0xFA,0xB,0x7B,0xFB,0xB,0x6E,0xA0,0xA1,0xA2,0xFB,0xB,0x6E,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xCA,0x20,0xD0,0x1,0xC2,0x13,0xF1,0xFB,0xB,0xCC,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xCA,0x20,0xD0,0x1,0xC2,0x25,0xEE,0xFB,0xB,0xCC,0xC4,0xC1,0x0,0xDC,0x7F,0x6E,0xCC,0x0,0x75,0xCA,0x20,0xD0,0x1,0xC2,0x34,0x6C,0xFB,0xB,0xCC,0xFE,0x80,0xF9,0xB,0xCC,0xA0,0xA1,0xA2,0xE0,0x7F,0xCC,0x0,0x75,0x84,0xE4,0xFE,0x80,0xF9,0xB,0xDB,0xFA,0xB,0xE6,0xFB,0xB,0xD1,0xA0,0xA1,0xA2,0xFB,0xB,0xCC,0xC4,0xC1,0x0,0x6E,0xCC,0x0,0x75,0xD0,0x1,0xC2,0x36,0x18,0xFE,0x80,0xF9,0xB,0xF8,0xA0,0xA1,0xA2,0xCC,0x0,0x75,0xD4,0x0,0xDD,0x40,0xDC,0x7F,0x84,0xE4,0xFE,0x80,0xF9,0xC,0x17,0xFA,0xC,0x1F,0xF1,0xFB,0xB,0xFD,0x0,0xFA,0xC,0xB,0xF1,0xFB,0xB,0xF8,0xA0,0xA1,0xA2,0xF1,0xFB,0xB,0xF8,0xC7,0x0,0xC,0x2B,0xF8,0x14,0xFE,0x80,0x71,0xF5,0xC,0x34,0xF7,0xFF,0xDC,0x7F,0xE0,0x7F,0xD8,0x0,0x81,0x70,0xF6,0xF6,0xFF,0xC7,0x0,0xC,0x44,0xD4,0xA,0x75,0xFF,0xD,0x27,0xD,0x36,0xD,0x45,0xD,0x54,0xD,0x63,0xD,0x72,0xD,0x81,0xD,0x90,0xD,0xA1,0xD,0xB0,0xD,0xBF,0xD,0xCE,0xD,0xDD,0xD,0xEC,0xD,0xFB,0xE,0xA,0xE,0x1B,0xE,0x27,0xE,0x33,0xE,0x3F,0xE,0x4B,0xE,0x57,0xE,0x63,0xE,0x6F,0xE,0x7B,0xE,0x8A,0xE,0x99,0xE,0xA8,0xE,0xB7,0xE,0xC6,0xE,0xD5,0xE,0xE4,0xE,0xF5,0xF,0x1,0xF,0xD,0xF,0x19,0xF,0x25,0xF,0x31,0xF,0x3D,0xF,0x49,0xF,0x55,0xF,0x64,0xF,0x73,0xF,0x83,0xF,0x92,0xF,0xA4,0xF,0xC0,0xF,0xD0,0xF,0xE0,0xF,0xEC,0xF,0xF8,0x10,0xD,0x10,0x1D,0x10,0x29,0x10,0x3B,0x10,0x47,0x10,0x47,0x10,0x47,0x10,0x59,0x10,0x6C,0x10,0x7D,0x10,0x8C,0x10,0x9E,0x10,0xB0,0x10,0xBC,0x10,0xCE,0x10,0xE4,0x10,0xF3,0x10,0xFF,0x11,0x4C,0x11,0x5F,0x11,0xA4,0x11,0xC4,0x11,0xC4,0x11,0xC4,0x11,0xC4,0x11,0xC4,0x11,0xD7,0x11,0xE6,0x11,0xE6,0x11,0xF5,0x12,0x7,0x12,0x19,0x12,0x2C,0x12,0x3E,0x12,0x51,0x12,0x61,0x12,0x7D,0x12,0xA0,0x12,0xC0,0x12,0xE8,0x12,0xFC,0x13,0xB,0x13,0x23,0x13,0x46,0x13,0x5E,0x13,0x71,0x13,0x81,0x13,0x91,0x13,0xA1,0x13,0xB1,0x13,0xC1,0x13,0xD1,0x13,0xE1,0xD,0x27,0xD,0x27,0xD,0x27,0xD,0x27,0xD,0x27,0xD,0x27,0xD,0x27,0xD,0x27,0xC6,0x1,0xC1,0x0,0x90,0xD,0x2F,0xFF,0x69,0xC,0x75,0x6E,0x18,0x75,0xFF,0xC6,0x1,0xC1,0x1,0x90,0xD,0x3E,0xFF,0x69,0xC,0x78,0x72,0x18,0x78,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xD,0x4D,0xFF,0x69,0x6,0x50,0x72,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x3,0x90,0xD,0x5C,0xFF,0x69,0xC,0x7F,0x72,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x4,0x90,0xD,0x6B,0xFF,0x69,0xC,0x5A,0x72,0x18,0x5A,0xFF,0xC6,0x1,0xC1,0x5,0x90,0xD,0x7A,0xFF,0x69,0xC,0x50,0x72,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x6,0x90,0xD,0x89,0xFF,0x5D,0xC,0x7F,0x66,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xD,0x98,0xFF,0x22,0xC,0x64,0x7F,0x2B,0x24,0x64,0x7F,0xFF,0xC6,0x1,0xC1,0x0,0x90,0xD,0xA9,0xFF,0x6E,0xC,0x75,0x69,0x18,0x75,0xFF,0xC6,0x1,0xC1,0x1,0x90,0xD,0xB8,0xFF,0x72,0xC,0x78,0x69,0x18,0x78,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xD,0xC7,0xFF,0x72,0xC,0x50,0x69,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x3,0x90,0xD,0xD6,0xFF,0x72,0xC,0x7F,0x69,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x4,0x90,0xD,0xE5,0xFF,0x72,0xC,0x5A,0x69,0x18,0x5A,0xFF,0xC6,0x1,0xC1,0x5,0x90,0xD,0xF4,0xFF,0x72,0xC,0x50,0x69,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x6,0x90,0xE,0x3,0xFF,0x66,0xC,0x7F,0x5D,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xE,0x12,0xFF,0x2B,0xC,0x64,0x7F,0x22,0x24,0x64,0x7F,0xFF,0xC6,0x1,0xC1,0x0,0x90,0xE,0x23,0xFF,0x67,0x18,0x55,0xFF,0xC6,0x1,0xC1,0x1,0x90,0xE,0x2F,0xFF,0x67,0x18,0x64,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xE,0x3B,0xFF,0x6B,0x18,0x3F,0xFF,0xC6,0x1,0xC1,0x3,0x90,0xE,0x47,0xFF,0x67,0x18,0x4D,0xFF,0xC6,0x1,0xC1,0x4,0x90,0xE,0x53,0xFF,0x67,0x18,0x46,0xFF,0xC6,0x1,0xC1,0x5,0x90,0xE,0x5F,0xFF,0x67,0x18,0x44,0xFF,0xC6,0x1,0xC1,0x6,0x90,0xE,0x6B,0xFF,0x67,0x18,0x64,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xE,0x77,0xFF,0x67,0x18,0x46,0xFF,0xC6,0x1,0xC1,0x0,0x90,0xE,0x83,0xFF,0x51,0xC,0x75,0x53,0x18,0x75,0xFF,0xC6,0x1,0xC1,0x1,0x90,0xE,0x92,0xFF,0x5D,0xC,0x78,0x5F,0x18,0x78,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xE,0xA1,0xFF,0x62,0xC,0x50,0x67,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x3,0x90,0xE,0xB0,0xFF,0x5D,0xC,0x73,0x5F,0xC,0x73,0xFF,0xC6,0x1,0xC1,0x4,0x90,0xE,0xBF,0xFF,0x5D,0xC,0x5A,0x5F,0x18,0x5A,0xFF,0xC6,0x1,0xC1,0x5,0x90,0xE,0xCE,0xFF,0x62,0xC,0x50,0x64,0x18,0x50,0xFF,0xC6,0x1,0xC1,0x6,0x90,0xE,0xDD,0xFF,0x5D,0xC,0x7F,0x5F,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xE,0xEC,0xFF,0x1F,0xC,0x64,0x7F,0x20,0x24,0x64,0x7F,0xFF,0xC6,0x1,0xC1,0x0,0x90,0xE,0xFD,0xFF,0x65,0x18,0x3F,0xFF,0xC6,0x1,0xC1,0x1,0x90,0xF,0x9,0xFF,0x65,0x18,0x39,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xF,0x15,0xFF,0x67,0x18,0x27,0xFF,0xC6,0x1,0xC1,0x3,0x90,0xF,0x21,0xFF,0x65,0x18,0x31,0xFF,0xC6,0x1,0xC1,0x4,0x90,0xF,0x2D,0xFF,0x65,0x18,0x27,0xFF,0xC6,0x1,0xC1,0x5,0x90,0xF,0x39,0xFF,0x65,0x18,0x27,0xFF,0xC6,0x1,0xC1,0x6,0x90,0xF,0x45,0xFF,0x65,0x18,0x46,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xF,0x51,0xFF,0x63,0x18,0x31,0xFF,0xC6,0x1,0xC1,0x7,0x90,0xF,0x5D,0xFF,0x5D,0xC,0x64,0x66,0x12,0x64,0xFF,0xC6,0x1,0xC1,0x7,0x90,0xF,0x6C,0xFF,0x66,0xC,0x64,0x5D,0x18,0x64,0xFF,0xC6,0x1,0xC1,0x7,0x90,0xF,0x7B,0xFF,0xC7,0x85,0x1B,0xFF,0x5F,0x10,0x64,0xFF,0xC6,0x1,0xC1,0x7,0x90,0xF,0x8B,0xFF,0x54,0xC,0x64,0x58,0x18,0x64,0xFF,0xC6,0x3,0xC1,0x6,0xDA,0x3D,0xF4,0x90,0xF,0x9D,0xFF,0x7E,0x6,0x5A,0x7A,0x7,0x5A,0xFF,0xC6,0x0,0xC1,0x2,0x90,0xF,0xB8,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x1,0xDA,0x3D,0xC4,0xFF,0x7E,0x4,0x7F,0x38,0x3,0x7F,0x50,0xFF,0xC6,0x1,0xC1,0x8,0x90,0xF,0xC8,0xFF,0xC7,0x1,0x1D,0x12,0x58,0x12,0x73,0xFF,0xC6,0x1,0xC1,0x7,0x90,0xF,0xD8,0xFF,0xC7,0x85,0x19,0xFF,0x5D,0x10,0x46,0xFF,0xC6,0x2,0xC1,0x0,0x90,0xF,0xE8,0xFF,0x67,0x7F,0x64,0xFF,0xC6,0x2,0xC1,0x1,0x90,0xF,0xF4,0xFF,0x64,0x64,0x5A,0xFF,0xC6,0x2,0x90,0xF,0xFE,0xFF,0xC6,0x2,0x64,0xA,0x50,0xC6,0x0,0xC7,0x81,0x24,0xFF,0x72,0x32,0x50,0xFF,0xC6,0x2,0xC1,0x2,0x90,0x10,0x15,0xFF,0xC7,0x81,0x23,0xFF,0x5E,0x3C,0x6E,0xFF,0xC6,0x2,0xC1,0x2,0x90,0x10,0x25,0xFF,0x67,0x7F,0x73,0xFF,0xC6,0x0,0xC1,0x0,0x90,0x10,0x33,0xFF,0xC2,0x1,0xC7,0x81,0x2E,0xFF,0x5F,0xF,0x64,0xFF,0xC6,0x0,0xC1,0x0,0x90,0x10,0x43,0xFF,0x67,0x12,0x64,0xFF,0xC6,0x0,0xC1,0x0,0xD9,0x1E,0x90,0x10,0x51,0xFF,0xC7,0x81,0x22,0xFF,0x69,0xC,0x7F,0xFF,0xC6,0x0,0xC1,0x1,0x90,0x10,0x61,0xFF,0x65,0xA,0x69,0xC7,0x81,0x2A,0xFF,0x65,0x1E,0x69,0xFF,0xC6,0x0,0xC1,0x1,0x90,0x10,0x74,0xFF,0xC7,0x81,0x2C,0xFF,0x68,0x80,0xB4,0x64,0xFF,0xC6,0x0,0xC1,0x2,0x90,0x10,0x85,0xFF,0x67,0x4,0x7F,0x69,0x12,0x7F,0xFF,0xC6,0x1,0xC1,0x1,0xDA,0x3D,0xB4,0x90,0x10,0x97,0xFF,0x66,0x6,0x7F,0x69,0x6,0x7F,0xFF,0xC6,0x1,0xC1,0x1,0xDA,0x3D,0xB4,0x90,0x10,0xA9,0xFF,0x69,0x6,0x7F,0x66,0x6,0x7F,0xFF,0xC6,0x0,0xC1,0x2,0x90,0x10,0xB8,0xFF,0x60,0xA,0x7F,0xFF,0xC6,0x0,0xC1,0x1,0xDA,0x3D,0xB4,0x90,0x10,0xC7,0xFF,0x67,0x8,0x5A,0x69,0x8,0x5A,0xFF,0xC6,0x3,0xC1,0x1,0xDA,0x3D,0xD4,0x90,0x10,0xD9,0xFF,0xC7,0x85,0x35,0xFF,0x77,0xC,0x7F,0x75,0x18,0x7F,0xFF,0xC6,0x1,0xC1,0x7,0x90,0x10,0xEC,0xFF,0x67,0x7,0x64,0x54,0x18,0x73,0xFF,0xC6,0x0,0xC1,0x4,0x90,0x10,0xFB,0xFF,0x65,0x48,0x7F,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x11,0x13,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0xA,0xDA,0x3E,0x4,0xFF,0xC7,0x81,0x1B,0xFF,0x6E,0xB,0x7F,0xC4,0xC7,0x85,0x20,0xFF,0x6C,0x5,0x64,0xFC,0x11,0x45,0xC2,0x1,0xFC,0x11,0x45,0xC2,0x3,0xFC,0x11,0x45,0xC2,0x4,0xFC,0x11,0x45,0xC2,0x6,0xFC,0x11,0x45,0xC2,0x7,0xFC,0x11,0x45,0xC2,0x9,0xFC,0x11,0x45,0xC2,0xA,0x54,0x5,0x73,0x60,0x5,0x73,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x11,0x54,0xFF,0xC7,0x82,0x13,0xFF,0x62,0x5,0x6E,0x67,0x2,0x6E,0xFF,0xC6,0x3,0xC1,0x3,0xCC,0x32,0xFC,0xC,0x3F,0xDA,0x3E,0x14,0x90,0x11,0x8A,0xFD,0x1,0x91,0x11,0x9C,0xC6,0x9,0xC1,0x1,0xDA,0x3D,0xC4,0xD9,0x14,0xFD,0x1,0x92,0x11,0x94,0xC6,0x4,0xC1,0xE,0xD9,0xC,0xD8,0xA,0xFF,0xC2,0x24,0xC7,0x81,0x3E,0xFF,0x66,0x7F,0x7F,0xFF,0xC7,0x81,0x27,0xFF,0x4F,0x7F,0x7F,0xFF,0xC7,0x81,0x3E,0xFF,0x66,0x7F,0x64,0xFF,0xC6,0x2,0xC1,0x2,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x11,0xBC,0x91,0x11,0xB4,0xFF,0xC7,0x81,0x17,0xFF,0x7B,0x30,0x78,0xFF,0xC7,0x81,0x23,0xFF,0x6A,0x3C,0x6E,0xFF,0xC6,0x1,0xC1,0x0,0x90,0x11,0xCC,0xFF,0x51,0x6,0x7F,0xC7,0x81,0x1F,0xFF,0x47,0xC,0x7F,0xFF,0xC6,0x1,0xC1,0x5,0x90,0x11,0xDF,0xFF,0x57,0x6,0x7F,0x59,0xC,0x7F,0xFF,0xC6,0x1,0xC1,0x8,0x90,0x11,0xEE,0xFF,0x51,0x6,0x7F,0x53,0xC,0x7F,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x4,0x90,0x12,0x0,0xFF,0x54,0xF,0x5A,0x5D,0x17,0x5A,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x4,0x90,0x12,0x12,0xFF,0x5D,0xF,0x5A,0x54,0x1F,0x5A,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x4,0x90,0x12,0x24,0xFF,0xC7,0x85,0x12,0xFF,0x56,0x15,0x5A,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x4,0x90,0x12,0x37,0xFF,0x4B,0xF,0x5A,0x4F,0x1F,0x5A,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x4,0x90,0x12,0x49,0xFF,0xC7,0x85,0x12,0xFF,0x56,0x10,0x5A,0xFF,0xC6,0x6,0xC1,0xA,0xDA,0x3E,0x4,0x90,0x12,0x5C,0xFF,0xC2,0x8,0xFB,0x11,0x1A,0xC6,0x5,0xC1,0x6,0xDA,0x3E,0x9C,0x90,0x12,0x6F,0x91,0x12,0x71,0xFF,0xC2,0xC,0xC4,0xC7,0x85,0x1B,0xFF,0x73,0x14,0x7F,0x64,0x5A,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xD8,0x3C,0xD7,0x3C,0xDA,0x3D,0xD4,0x90,0x12,0x98,0x91,0x12,0x96,0xCC,0x24,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC2,0x1,0xC7,0x81,0x14,0x64,0x5B,0x30,0x7F,0xFF,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x34,0x90,0x12,0xB4,0xCC,0x4,0xFC,0xC,0x26,0xC6,0x9,0xC1,0x3,0xFF,0x6B,0x3,0x73,0x70,0x5,0x73,0xC2,0xC,0x77,0x6,0x50,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x12,0xD4,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0xA,0xDA,0x3E,0x4,0xFF,0xC7,0x81,0x1B,0xFF,0x69,0xB,0x7F,0xC4,0xC2,0xFC,0xC7,0x85,0x20,0xFF,0x6C,0x5,0x64,0xFB,0x11,0x45,0xC6,0x0,0xC1,0x3,0xD9,0x1E,0x90,0x12,0xF2,0xFF,0xC6,0x0,0xC7,0x81,0x20,0xFF,0x67,0x24,0x7F,0xFF,0xFB,0x38,0xCB,0xC6,0x0,0xC1,0x5,0x90,0x13,0x7,0xFF,0x69,0x3C,0x7F,0xFF,0xC6,0x1,0xC1,0x1,0xDA,0x3D,0xB4,0x90,0x13,0x16,0xFF,0x66,0x8,0x7F,0x69,0x9,0x7F,0x67,0xA,0x7F,0x6A,0x8,0x7F,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x13,0x37,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0xA,0xDA,0x3E,0x4,0xFF,0xC7,0x81,0x1B,0xFF,0x6E,0x7,0x7F,0xC7,0x85,0x3,0xFF,0x67,0xF,0x64,0xFF,0xC6,0x5,0xC1,0x6,0xDA,0x3E,0x9C,0x90,0x13,0x54,0x91,0x13,0x56,0xFF,0xC2,0xC,0xC7,0x85,0x1A,0xF0,0x73,0x53,0x7F,0xFF,0xC6,0x5,0xC1,0x6,0xDA,0x3E,0x9C,0x90,0x13,0x6C,0x91,0x12,0x71,0xFF,0xC2,0x8,0xFB,0x12,0x71,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x0,0x91,0xE,0x83,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x1,0x91,0xE,0x92,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x2,0xC1,0x1,0x91,0xE,0xA1,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x3,0x91,0xE,0xB0,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x4,0x91,0xE,0xBF,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x5,0x91,0xE,0xCE,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x6,0x91,0xE,0xDD,0xFF,0xFC,0x12,0xFF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x8,0x91,0xE,0xEC,0xFF,0x14,0x61,0x14,0x72,0x14,0x8F,0x14,0xB6,0x14,0xC7,0x14,0xE4,0x14,0xF5,0x15,0x6,0x14,0x61,0x14,0x72,0x14,0x8F,0x14,0xB6,0x14,0xC7,0x14,0xE4,0x14,0xF5,0x15,0x6,0x15,0x23,0x15,0x34,0x15,0x48,0x1C,0xCB,0x15,0x5D,0x1C,0xCB,0x15,0x72,0x15,0x87,0x15,0x9E,0x15,0xBB,0x15,0xBE,0x14,0xB6,0x14,0xC7,0x14,0xE4,0x14,0xF5,0x15,0x6,0x15,0xE5,0x15,0xF2,0x16,0x8,0x16,0x26,0x16,0x33,0x16,0x49,0x16,0x56,0x16,0x63,0x16,0x79,0x15,0xF2,0x16,0x8,0x16,0x26,0x16,0x33,0x16,0x49,0x16,0x56,0x16,0x63,0x15,0xE5,0x15,0xF2,0x16,0x8,0x16,0x26,0x16,0x33,0x16,0x49,0x16,0x56,0x16,0x63,0xC6,0x3,0xC1,0x0,0x90,0x14,0x69,0xFF,0xC4,0x67,0x81,0x2C,0x50,0xFB,0x14,0x6A,0xFF,0xC6,0x1,0xC1,0x1,0x90,0x14,0x83,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x1,0xFF,0x69,0x8,0x69,0xC4,0x67,0x81,0x2C,0x46,0xFB,0x14,0x87,0xFF,0xC6,0x2,0xC1,0x1,0x90,0x14,0xA3,0x91,0x14,0xAE,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x2,0xFF,0xC0,0x1,0xC4,0x67,0x81,0x2C,0x58,0xFB,0x14,0xA6,0xFF,0xC7,0x81,0x27,0xFF,0x70,0x32,0x50,0xFF,0xC6,0x3,0xC1,0x3,0x90,0x14,0xBE,0xFF,0xC4,0x67,0x81,0x2C,0x44,0xFB,0x14,0xBF,0xFF,0xC6,0x1,0xC1,0x4,0x90,0x14,0xD8,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x4,0xFF,0x6A,0xC,0x4B,0xC4,0x67,0x81,0x2C,0x4C,0xFB,0x14,0xDC,0xFF,0xC6,0x3,0xC1,0x5,0x90,0x14,0xEC,0xFF,0xC4,0x67,0x81,0x2C,0x50,0xFB,0x14,0xED,0xFF,0xC6,0x3,0xC1,0x6,0x90,0x14,0xFD,0xFF,0xC4,0x67,0x81,0x2C,0x64,0xFB,0x14,0xFE,0xFF,0xC6,0x1,0xC1,0x8,0x90,0x15,0x17,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x7,0xFF,0x6A,0xC,0x64,0xC4,0x67,0x81,0x2C,0x51,0xFB,0x15,0x1B,0xFF,0xC6,0x3,0xC1,0x8,0x90,0x15,0x2B,0xFF,0xC4,0x67,0x81,0x2C,0x78,0xFB,0x15,0x2C,0xFF,0xC6,0x3,0xC1,0x1,0xDA,0x3D,0xC4,0x90,0x15,0x3F,0xFF,0xC4,0x6B,0x81,0x2C,0x50,0xFB,0x15,0x40,0xFF,0xC6,0x0,0xC1,0x1,0x90,0x15,0x50,0xFF,0xC7,0x81,0x2C,0xFF,0xC4,0x68,0x80,0xB4,0x64,0xFB,0x15,0x54,0xFF,0xC6,0x3,0xC1,0x7,0x90,0x15,0x65,0xFF,0xC4,0xC7,0x85,0x25,0xFF,0x62,0x80,0xC8,0x7F,0xFB,0x15,0x6A,0xFF,0xC6,0x3,0xC1,0x9,0x90,0x15,0x7F,0x91,0x15,0x7D,0xFF,0xC2,0x18,0x6B,0x80,0x6,0x7F,0xFB,0x15,0x7F,0xFF,0xC6,0x5,0xC1,0x6,0x90,0x15,0x96,0x91,0x15,0x92,0xFF,0xC6,0xD,0xC2,0xF4,0xC4,0x6B,0x81,0x2C,0x69,0xFB,0x15,0x97,0xC6,0x9,0xC1,0x3,0xCC,0x28,0xFC,0xC,0x3F,0xDA,0x3E,0x34,0x90,0x15,0xAE,0xFF,0xC2,0xC,0x3C,0xC,0x64,0x7F,0x3C,0x30,0x64,0x7F,0xFB,0x15,0xB0,0xFB,0x34,0xBD,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x58,0x90,0x15,0xD3,0x91,0x15,0xD1,0x92,0x15,0xCF,0xFF,0xC0,0x4,0xC0,0x4,0xC2,0x18,0xC7,0x85,0x20,0x28,0x67,0x9,0x64,0x6C,0x6,0x32,0x73,0x3,0x14,0xFB,0x15,0xD5,0xC6,0x3,0xC1,0x0,0x90,0x15,0xED,0xFF,0xC2,0x4,0xFB,0x14,0x69,0xC6,0x1,0xC1,0x1,0x90,0x16,0x3,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x1,0xFF,0xC2,0x4,0xFB,0x14,0x83,0xC6,0x2,0xC1,0x1,0x90,0x16,0x1C,0x91,0x16,0x21,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x2,0xFF,0xC2,0x4,0xFB,0x14,0xA3,0xC2,0x4,0xFB,0x14,0xAE,0xC6,0x3,0xC1,0x3,0x90,0x16,0x2E,0xFF,0xC2,0x4,0xFB,0x14,0xBE,0xC6,0x1,0xC1,0x4,0x90,0x16,0x44,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x4,0xFF,0xC2,0x4,0xFB,0x14,0xD8,0xC6,0x3,0xC1,0x5,0x90,0x16,0x51,0xFF,0xC2,0x4,0xFB,0x14,0xEC,0xC6,0x3,0xC1,0x6,0x90,0x16,0x5E,0xFF,0xC2,0x4,0xFB,0x14,0xFD,0xC6,0x1,0xC1,0x8,0x90,0x16,0x74,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x7,0xFF,0xC2,0x4,0xFB,0x15,0x17,0x90,0x16,0x9A,0x91,0x16,0xA3,0xC6,0x3,0xC1,0x2,0xCC,0x1,0xFC,0xC,0x26,0xD9,0x1E,0xC6,0x2,0xC1,0x1,0xDA,0x3E,0x24,0xCC,0x1,0xFC,0xC,0x26,0xFB,0x16,0x7F,0xFF,0xC4,0x6A,0x81,0x2C,0x58,0xFB,0x16,0x9B,0xFF,0xC0,0x1,0xC7,0x81,0x29,0xFF,0x78,0xA,0x7F,0xFB,0x16,0xA5,0x17,0x4D,0x17,0x3F,0x17,0x2F,0x17,0x5F,0x17,0x6F,0x17,0x85,0x17,0x97,0x17,0xA5,0x17,0xB3,0x17,0xC1,0x17,0xCF,0x17,0xDD,0x17,0xEB,0x17,0xFC,0x18,0xA,0x18,0x18,0x18,0x26,0x18,0x35,0x18,0x81,0x18,0x43,0x18,0x51,0x18,0x60,0x18,0x6F,0x18,0xCF,0x18,0x81,0x18,0x8F,0x18,0x9F,0x18,0xAF,0x18,0xBD,0x18,0xCF,0x18,0xE5,0x18,0xFE,0x19,0x1C,0x19,0x2D,0x19,0x39,0x19,0x3C,0x19,0x49,0x17,0x85,0x17,0x97,0x17,0xA5,0x19,0x62,0x17,0x2F,0x17,0x2F,0x17,0x6F,0x17,0x6F,0x17,0x6F,0x19,0x6F,0x19,0x7B,0x19,0x87,0x19,0x93,0x19,0x9F,0x19,0xAB,0x19,0xB8,0x19,0xC4,0x19,0xE7,0x19,0xFB,0x1A,0x8,0x1A,0x17,0x1A,0x27,0x1A,0x37,0x1A,0x46,0x1A,0x56,0x1A,0x66,0x1A,0x75,0xC6,0x8,0xC1,0x0,0x90,0x17,0x37,0xFF,0xC7,0x82,0x29,0x7F,0x65,0x14,0x7F,0xFF,0xC6,0x8,0xC1,0x1,0x90,0x17,0x47,0xFF,0xC2,0xFE,0x66,0x18,0x7F,0xFF,0xC6,0xA,0xC1,0x9,0x90,0x17,0x55,0xFF,0xC2,0xFE,0xC7,0x82,0x27,0xC8,0x66,0x24,0x78,0xFF,0xC6,0xA,0xC1,0x1,0x90,0x17,0x67,0xFF,0xC7,0x82,0x2C,0xC8,0x67,0x30,0x7F,0xFF,0xC6,0x8,0xC1,0x4,0x90,0x17,0x77,0xFF,0xC2,0xFE,0xC4,0xC7,0x85,0x27,0xFF,0x6A,0x1E,0x6E,0x67,0x41,0x6E,0xFF,0xC6,0x8,0xC1,0x5,0x90,0x17,0x8D,0xFF,0xC2,0xFE,0xC7,0x81,0x29,0xFF,0x66,0x2B,0x73,0xFF,0xC6,0x8,0xC1,0x6,0x90,0x17,0x9F,0xFF,0xC2,0xFE,0x6C,0x1E,0x6E,0xFF,0xC6,0x8,0xC1,0x7,0x90,0x17,0xAD,0xFF,0xC2,0xFD,0x67,0x1C,0x7F,0xFF,0xC6,0x8,0xC1,0x8,0x90,0x17,0xBB,0xFF,0xC2,0xFE,0x68,0x30,0x6E,0xFF,0xC6,0x8,0xC1,0x9,0x90,0x17,0xC9,0xFF,0xC2,0xFE,0x68,0x44,0x69,0xFF,0xC6,0x8,0xC1,0xA,0x90,0x17,0xD7,0xFF,0xC2,0xFE,0x69,0x30,0x78,0xFF,0xC6,0x8,0xC1,0xB,0x90,0x17,0xE5,0xFF,0xC2,0xFE,0x66,0x30,0x7F,0xFF,0xC6,0x8,0xC1,0xC,0x90,0x17,0xF3,0xFF,0xC7,0x81,0x26,0xC8,0x69,0x80,0x85,0x7F,0xFF,0xC6,0x8,0xC1,0xD,0x90,0x18,0x4,0xFF,0xC2,0xFE,0x67,0x7F,0x69,0xFF,0xC6,0x8,0xC1,0xE,0x90,0x18,0x12,0xFF,0xC2,0xFE,0x67,0x60,0x40,0xFF,0xC6,0x8,0xC1,0xF,0x90,0x18,0x20,0xFF,0xC2,0xFE,0x67,0x5C,0x34,0xFF,0xC6,0xA,0xC1,0x0,0x90,0x18,0x2E,0xFF,0xC2,0xFE,0x67,0x80,0xAA,0x7F,0xFF,0xC6,0x8,0xC1,0x3,0x90,0x18,0x3D,0xFF,0xC2,0xFF,0x67,0x4D,0x78,0xFF,0xC6,0xA,0xC1,0x6,0x90,0x18,0x4B,0xFF,0xC2,0xFE,0x6B,0x1E,0x69,0xFF,0xC6,0xA,0xC1,0x5,0x90,0x18,0x59,0xFF,0xC2,0xFE,0x67,0x80,0xC8,0x7F,0xFF,0xC6,0xA,0xC1,0x4,0x90,0x18,0x68,0xFF,0xC2,0xFE,0x67,0x80,0x8C,0x6E,0xFF,0xC6,0xA,0xC1,0x2,0x90,0x18,0x77,0xFF,0xC2,0xFE,0xC7,0x82,0x23,0xFF,0x66,0x30,0x7F,0xFF,0xC6,0xA,0xC1,0x2,0x90,0x18,0x89,0xFF,0xC2,0xFE,0x67,0x3C,0x64,0xFF,0xC6,0xA,0xC1,0x2,0x90,0x18,0x97,0xFF,0xC2,0xFE,0xC0,0x4,0x66,0x3C,0x64,0xFF,0xC6,0xA,0xC1,0x2,0x90,0x18,0xA7,0xFF,0xC2,0xFE,0xC0,0x8,0x68,0x3C,0x64,0xFF,0xC6,0xA,0xC1,0x7,0x90,0x18,0xB7,0xFF,0xC2,0xFE,0x67,0x10,0x73,0xFF,0xC6,0xA,0xC1,0x7,0x90,0x18,0xC5,0xFF,0xC2,0xFE,0xC7,0x81,0x26,0xFF,0x69,0x18,0x73,0xFF,0xC6,0xA,0xC1,0x7,0x90,0x18,0xD7,0xFF,0xC2,0xFE,0xC4,0xC7,0x85,0x26,0xFF,0x69,0xC,0x73,0x63,0x12,0x73,0xFF,0xC6,0xA,0xC1,0x9,0x90,0x18,0xF9,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x10,0x33,0xFF,0xC2,0xFE,0xFB,0x17,0x57,0xC6,0xA,0xC1,0xA,0x90,0x19,0x12,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x10,0x43,0xFF,0xC2,0xFE,0xC7,0x81,0x2A,0xFF,0x66,0x30,0x73,0xFF,0xC6,0xA,0xC1,0xB,0x90,0x19,0x24,0xFF,0xC7,0x81,0x26,0xFF,0x64,0x80,0x8C,0x73,0xFF,0xC6,0xA,0xC1,0xC,0x90,0x19,0x35,0xFF,0x67,0x60,0x73,0xFF,0xFB,0x17,0xA5,0xC6,0xA,0xC1,0xD,0x90,0x19,0x44,0xFF,0x66,0x80,0x91,0x7F,0xFF,0xC6,0x8,0xC1,0x1,0x90,0x19,0x5D,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x0,0x91,0x10,0x31,0xFF,0xC2,0xFF,0xFB,0x17,0x49,0xC6,0xA,0xC1,0xF,0x90,0x19,0x6A,0xFF,0x67,0x82,0xBC,0x7F,0xFF,0xC6,0x8,0xC1,0x18,0x90,0x19,0x77,0xFF,0x67,0x5A,0x7F,0xFF,0xC6,0x8,0xC1,0x19,0x90,0x19,0x83,0xFF,0x67,0x5A,0x61,0xFF,0xC6,0x8,0xC1,0x10,0x90,0x19,0x8F,0xFF,0x69,0x46,0x7F,0xFF,0xC6,0x8,0xC1,0x11,0x90,0x19,0x9B,0xFF,0x67,0x55,0x6E,0xFF,0xC6,0x8,0xC1,0x12,0x90,0x19,0xA7,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0x8,0xC1,0x13,0x90,0x19,0xB3,0xFF,0x67,0x81,0x2C,0x7F,0xFF,0xC6,0x8,0xC1,0x14,0x90,0x19,0xC0,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0x8,0x90,0x19,0xCA,0xFF,0xC0,0x4E,0xF8,0x32,0xFC,0x19,0xDC,0xF7,0xC6,0x15,0x67,0x84,0x4C,0x7F,0xFB,0x19,0xCC,0xFF,0xC6,0x15,0x65,0x53,0x7F,0xC6,0xF,0x65,0x4E,0x40,0xFF,0xC6,0x8,0xC1,0x16,0x90,0x19,0xF2,0x91,0x19,0xF2,0xFF,0xC7,0x82,0x2A,0xC8,0x67,0x80,0xC8,0x6E,0xFF,0xC6,0x8,0xC1,0x17,0x90,0x1A,0x3,0xFF,0x67,0x80,0x96,0x6E,0xFF,0xC6,0xA,0xC1,0x10,0x90,0x1A,0x13,0x91,0x1A,0x13,0xFF,0x67,0x46,0x7F,0xFF,0xC6,0xA,0xC1,0x11,0x90,0x1A,0x22,0x91,0x1A,0x22,0xFF,0x67,0x81,0x5E,0x7F,0xFF,0xC6,0xA,0xC1,0x12,0x90,0x1A,0x32,0x91,0x1A,0x32,0xFF,0x67,0x80,0xB4,0x7F,0xFF,0xC6,0xA,0xC1,0x13,0x90,0x1A,0x42,0x91,0x1A,0x42,0xFF,0x67,0x64,0x7F,0xFF,0xC6,0xA,0xC1,0x14,0x90,0x1A,0x51,0x91,0x1A,0x51,0xFF,0x67,0x80,0xDC,0x7F,0xFF,0xC6,0xA,0xC1,0x15,0x90,0x1A,0x61,0x91,0x1A,0x61,0xFF,0x67,0x81,0x90,0x7F,0xFF,0xC6,0xA,0xC1,0x16,0x90,0x1A,0x71,0x91,0x1A,0x71,0xFF,0x67,0x50,0x7F,0xFF,0xC6,0xA,0xC1,0x17,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x1A,0x85,0x91,0x1A,0x85,0xFF,0x67,0x50,0x7F,0xFF,0x1B,0x89,0x1B,0xA2,0x1B,0xA2,0x1B,0xAE,0x1B,0xC5,0x1B,0xD6,0x1B,0xE5,0x1C,0xB,0x1C,0x17,0x1C,0x2B,0x2A,0x49,0x1C,0x48,0x1C,0x54,0x1C,0x68,0x1C,0x78,0x1C,0x84,0x1C,0xCB,0x1C,0xCB,0x1C,0xEE,0x1C,0xEE,0x1C,0xEE,0x1C,0xEE,0x1D,0x55,0x1D,0x6A,0x1D,0x79,0x1D,0x79,0x1D,0x85,0x1D,0x85,0x1D,0x85,0x1D,0x85,0x1D,0x85,0x1D,0x85,0x1D,0x91,0x1D,0x91,0x1D,0xBA,0x1D,0xBA,0x1D,0xCF,0x1D,0xE6,0x1D,0xFE,0x1E,0x11,0x1E,0x2B,0x1E,0x2B,0x1E,0x2B,0x1E,0x2B,0x1E,0x37,0x1E,0x43,0x1E,0x64,0x1E,0x80,0x1E,0xA0,0x1E,0xB5,0x1E,0xCF,0x1C,0xCB,0x1E,0xE8,0x1E,0xF8,0x1F,0x8,0x1F,0x24,0x1F,0x46,0x1F,0x6C,0x1F,0x99,0x1F,0xE5,0x1F,0xF9,0x20,0x14,0x20,0x2A,0x20,0x46,0x20,0x5C,0x20,0x72,0x20,0x8C,0x20,0x9D,0x20,0xB4,0x20,0xC8,0x20,0xD5,0x20,0xED,0x20,0xFA,0x21,0xE,0x21,0x36,0x21,0x48,0x21,0x86,0x21,0xB6,0x21,0xD3,0x21,0xE6,0x3C,0x95,0x3C,0xCD,0x3D,0x3,0x3D,0x37,0x3D,0x81,0x3D,0x7C,0x21,0xF9,0x22,0xD,0x22,0x1D,0x22,0x44,0x22,0x5C,0x22,0x6B,0x22,0x7E,0x22,0x91,0x22,0xA6,0x22,0xB2,0x22,0xCC,0x23,0x1C,0x23,0x4A,0x23,0x5D,0x23,0x76,0x23,0xA2,0x23,0xBB,0x23,0xD2,0x23,0xEE,0x24,0x25,0x24,0xC5,0x24,0xE5,0x25,0x2,0x25,0x12,0x25,0x22,0x25,0x25,0x25,0x28,0x25,0x34,0x25,0x51,0x25,0x69,0x25,0x82,0x25,0xAF,0x25,0xCB,0x1B,0xA2,0x23,0xEE,0x24,0x25,0x24,0xC5,0x24,0xE5,0x25,0x2,0x25,0x12,0x25,0x22,0x25,0x25,0xC6,0x5,0xC1,0x7,0x90,0x1B,0x9A,0xFD,0x1,0xC6,0x4,0xC1,0x9,0x91,0x20,0x32,0xFF,0xC7,0x1,0x1B,0x28,0x65,0x7F,0x78,0xFF,0xC6,0x4,0xC1,0x0,0x90,0x1B,0xAA,0xFF,0x67,0x30,0x55,0xFF,0xC6,0x3,0xC1,0x8,0xDA,0x3E,0x4,0x90,0x1B,0xB9,0xFF,0xC4,0xC7,0x85,0x22,0xFF,0x6B,0x8,0x7F,0x5B,0x7F,0x7F,0xFF,0xC6,0x4,0xC1,0x1,0x90,0x1B,0xCD,0xFF,0x67,0x18,0x64,0xC6,0x2,0x67,0x48,0x3C,0xFF,0xC6,0x4,0xC1,0x1,0x90,0x1B,0xDE,0xFF,0x65,0x6,0x64,0x62,0x18,0x64,0xFF,0xC6,0x4,0xC1,0x4,0x90,0x1B,0xF9,0x91,0x1C,0x3,0xCC,0x6,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x3,0xFF,0xC0,0xF,0xC7,0x81,0x27,0xFF,0x6C,0x38,0x73,0xFF,0xC7,0x81,0x2C,0xFF,0x62,0x2C,0x55,0xFF,0xC6,0x4,0xC1,0x4,0x90,0x1C,0x13,0xFF,0x67,0x30,0x73,0xFF,0xC6,0x4,0xC1,0x6,0x90,0x1C,0x1F,0xFF,0xC2,0x18,0x67,0xA,0x41,0x67,0x9,0x46,0x67,0x8,0x4B,0xFF,0xC6,0x4,0xC1,0x5,0x90,0x1C,0x33,0xFF,0x67,0x80,0x91,0x7F,0xFF,0xC6,0x4,0xC1,0x5,0x90,0x1C,0x40,0xFF,0xC7,0x81,0x1B,0xFF,0x60,0x60,0x7F,0xFF,0xC6,0x4,0xC1,0x6,0x90,0x1C,0x50,0xFF,0x67,0x14,0x46,0xFF,0xC6,0x4,0xC1,0xF,0x90,0x1C,0x5C,0xFF,0x60,0x18,0x7F,0xC7,0x81,0x29,0xFF,0x5B,0x80,0x96,0x7F,0xFF,0xC6,0x4,0xC1,0x6,0x90,0x1C,0x70,0xFF,0xC7,0x81,0x22,0xFF,0x65,0x18,0x50,0xFF,0xC6,0x4,0xC1,0x8,0x90,0x1C,0x80,0xFF,0x67,0x40,0x78,0xFF,0xC6,0x5,0xC1,0x7,0x90,0x1B,0x9A,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x9,0x91,0x1C,0x98,0xFF,0xC2,0xF4,0xC7,0x83,0x1B,0xFF,0x37,0x4,0x7F,0x40,0x33,0x5,0x7F,0x40,0x30,0x4,0x7F,0x40,0x2C,0x6,0x7F,0x40,0x29,0x9,0x7F,0x40,0x27,0x6,0x7F,0x40,0x25,0x7,0x7F,0x40,0x22,0x5,0x7F,0x40,0x1F,0x8,0x7F,0x40,0x1D,0x9,0x7F,0x40,0x18,0x8,0x7F,0x40,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0xD8,0x3,0xD7,0x3C,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x1C,0xDF,0xFF,0xC2,0x18,0x59,0x2,0x28,0x65,0x7,0x55,0x5E,0x5,0x28,0x6A,0x37,0x55,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0xD8,0xC,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x1D,0x3D,0x91,0x1D,0x4F,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x6,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0xCC,0x9,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x6,0xCC,0x3,0xFC,0xC,0x26,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0xCC,0x6,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x6,0xCC,0x31,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC0,0x1,0xC6,0x6,0xC2,0x16,0x67,0xA,0x37,0x67,0x9,0x3C,0x67,0x8,0x41,0xC0,0x29,0xFF,0xC2,0x17,0xFC,0x1C,0xE1,0xFF,0xC6,0x4,0xC1,0xE,0xDA,0x3E,0xEC,0x90,0x1D,0x60,0xFF,0xC7,0x81,0x22,0x7F,0x66,0x30,0x7F,0xC0,0x30,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x1D,0x72,0xFF,0x65,0xA,0x64,0x5A,0x12,0x78,0xFF,0xC6,0x4,0xC1,0xA,0x90,0x1D,0x81,0xFF,0x67,0xF,0x78,0xFF,0xC6,0x4,0xC1,0xA,0x90,0x1D,0x8D,0xFF,0x65,0x12,0x78,0xFF,0xC6,0x7,0xC1,0x1,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x1D,0xAA,0x91,0x1D,0xAA,0xCC,0x6,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x4,0xFF,0x6B,0x5,0x7F,0x7E,0x9,0x7F,0xC6,0x2,0xC7,0x81,0x1B,0xFF,0x59,0x5A,0x6C,0xFF,0xC6,0x4,0xC1,0xB,0x90,0x1D,0xC2,0xFF,0x58,0xA,0x6E,0xC6,0x5,0xC7,0x82,0x1B,0xFF,0x60,0x73,0x7F,0xFF,0xC6,0x4,0xC1,0x1,0xDA,0x3E,0xBC,0x90,0x1D,0xDA,0xFF,0xC4,0x67,0x4,0x7F,0xC7,0x82,0x24,0xFF,0x5B,0x9,0x73,0xFF,0xC6,0x4,0xC1,0x2,0xDA,0x3F,0x44,0x90,0x1D,0xF4,0x91,0x1D,0xF6,0xFF,0xC2,0x3,0xC7,0x2,0x11,0x28,0x45,0x60,0x7F,0xFF,0xC6,0x4,0xC1,0xB,0x90,0x1E,0x6,0xFF,0x53,0x6,0x6E,0x5F,0x6,0x6E,0xC2,0x8,0xFB,0x1D,0xC5,0xC6,0x4,0xC1,0x5,0x90,0x1E,0x19,0xFF,0xC6,0xB,0x5F,0x6,0x7F,0x53,0x6,0x7F,0xC6,0x5,0xC7,0x82,0x14,0xFF,0x60,0x5A,0x7F,0xFF,0xC6,0x4,0xC1,0xD,0x90,0x1E,0x33,0xFF,0x67,0x73,0x5F,0xFF,0xC6,0x4,0xC1,0xE,0x90,0x1E,0x3F,0xFF,0x67,0x7F,0x73,0xFF,0xC6,0x4,0xC1,0xF,0x90,0x1E,0x4B,0xFF,0x24,0xD,0x73,0x14,0x22,0xE,0x73,0x14,0x20,0xD,0x73,0x14,0x1F,0xA,0x73,0x14,0x1E,0x7,0x73,0x14,0x1D,0x60,0x73,0x14,0xFF,0xC6,0x4,0xC1,0xF,0xDA,0x3E,0xDC,0x90,0x1E,0x76,0x91,0x1E,0x72,0xFF,0x4F,0x7F,0x7F,0xFF,0x77,0x6,0x73,0x6B,0xC,0x73,0x62,0x7F,0x7F,0xFF,0xC6,0x4,0xC1,0xF,0x90,0x1E,0x90,0x91,0x1E,0x9B,0x92,0x1E,0x8E,0xFF,0xC2,0x6,0x6C,0x7,0x7F,0x67,0x8,0x7F,0x64,0x80,0x96,0x7F,0xFF,0x56,0x80,0x96,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x1E,0xAD,0xFF,0xC7,0x81,0x24,0xFF,0x70,0x6,0x50,0xFF,0xC6,0x4,0xC1,0xF,0xDA,0x3E,0xDC,0x90,0x1E,0xC3,0x91,0x1E,0xCB,0xFF,0xC7,0x81,0x38,0xFF,0x54,0x78,0x50,0xFF,0x4F,0x78,0x7F,0xFF,0xC6,0x4,0xC1,0x6,0x90,0x1E,0xD7,0xFF,0xC7,0x81,0x25,0xFF,0x67,0x8,0x7F,0xC6,0x5,0xC7,0x81,0x14,0xFF,0x59,0x60,0x7F,0xFF,0xC6,0x4,0xC1,0x2,0x90,0x1E,0xF0,0xFF,0xC7,0x81,0xC,0xFF,0x4D,0x6E,0x7F,0xFF,0xC6,0x4,0xC1,0x2,0x90,0x1F,0x0,0xFF,0xC7,0x81,0xF,0xFF,0x4B,0x6E,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x28,0xFC,0xC,0x3F,0x90,0x1F,0x15,0xFF,0xC2,0x18,0x67,0x4,0x5A,0x73,0xC,0x5A,0x67,0x4,0x32,0x73,0xC,0x32,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x28,0xFC,0xC,0x3F,0x90,0x1F,0x31,0xFF,0xC2,0xC,0x67,0x3,0x5A,0x73,0x3,0x5A,0x5B,0xA,0x73,0x67,0x3,0x32,0x73,0x3,0x32,0x5B,0xA,0x4B,0xFF,0xC6,0x4,0xC1,0x9,0xCC,0x32,0xFC,0xC,0x3F,0x90,0x1F,0x5E,0xCC,0xD,0xFC,0xC,0x26,0xD9,0x1E,0xC6,0x4,0xC1,0x2,0xFF,0x61,0xC,0x64,0x59,0x28,0x78,0xC7,0x81,0x16,0xFF,0x4F,0x48,0x50,0xFF,0xC6,0x1,0xC1,0x1,0xCC,0xF,0xFC,0xC,0x3F,0x90,0x1F,0x85,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x7,0xDA,0x3E,0x58,0xFF,0x5D,0xC,0x78,0xC2,0xC,0xC7,0x81,0x33,0xFF,0x75,0x6,0x76,0xC7,0x81,0x34,0xFF,0x76,0x9,0x76,0xFF,0xC6,0x7,0xC1,0xE,0xCC,0xF,0xFC,0xC,0x3F,0x90,0x1F,0xC1,0x91,0x1F,0xDE,0x92,0x1F,0xDE,0xCC,0x1,0xFC,0xC,0x26,0xDA,0x3E,0x58,0xC6,0x1,0xC1,0x7,0xCC,0xD,0xFC,0xC,0x26,0xC6,0x7,0xC1,0xE,0xFF,0xC0,0x1,0xC2,0xC,0xC7,0x81,0x36,0xFF,0x37,0x6,0x76,0x7F,0xC7,0x81,0x37,0xFF,0x38,0x5,0x76,0x7F,0xC7,0x81,0x39,0xFF,0x3A,0xC,0x76,0x7F,0xFF,0xF8,0x2,0x62,0x19,0x64,0xF7,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x1F,0xED,0xFF,0x1F,0x12,0x50,0x50,0xC7,0x82,0x35,0xFF,0x6C,0x7,0x58,0xFF,0xC6,0x3,0xC1,0x5,0xDA,0x3D,0xC4,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x20,0x9,0xFF,0x69,0x4,0x64,0x22,0x14,0x64,0x64,0x5D,0x6,0x73,0xFF,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x20,0x26,0x91,0x20,0x24,0xC6,0x4,0xC1,0x1,0xFF,0xC2,0x1,0x4F,0x2C,0x7F,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x20,0x34,0xFF,0xC2,0xFD,0x67,0x6,0x78,0xC7,0x81,0xF,0xFF,0x48,0xC,0x78,0xC7,0x81,0x1B,0xFF,0x43,0x18,0x78,0xFF,0xC6,0x4,0xC1,0x3,0xCC,0x1E,0xFC,0xC,0x3F,0x90,0x20,0x53,0xFF,0xC7,0x81,0x13,0x28,0x56,0x80,0xB4,0x73,0xFF,0xC6,0x5,0xC1,0x5,0xDA,0x3E,0x34,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x20,0x6C,0xFF,0x4E,0x34,0x6E,0xC0,0x14,0xFF,0xC6,0x5,0xC1,0x7,0x90,0x20,0x7D,0x91,0x20,0x7D,0xFF,0xC4,0xC7,0x85,0x27,0xFF,0x64,0x14,0x6E,0x66,0x10,0x6E,0x5B,0x64,0x6E,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x20,0x94,0xFF,0x24,0xA,0x50,0x50,0x18,0xA,0x50,0x50,0xFF,0xC6,0x6,0xC1,0xF,0x90,0x20,0xA5,0xFF,0xC4,0xC7,0x85,0x23,0xFF,0x62,0x60,0x7F,0x60,0x60,0x7F,0x60,0x30,0x7F,0xFF,0xC6,0x6,0xC1,0x1,0xCC,0x37,0xFC,0xC,0x3F,0x90,0x20,0xC1,0xFF,0x60,0xC,0x7F,0x5B,0x30,0x7F,0xFF,0xC6,0x6,0xC1,0xF,0x90,0x20,0xD0,0xFF,0x5F,0x80,0xC0,0x7F,0xFF,0xC6,0x7,0xC1,0x1,0x90,0x20,0xE6,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x5,0xC1,0x5,0xFF,0x58,0xC,0x7F,0x56,0x48,0x7F,0xFF,0xC6,0x6,0xC1,0xA,0x90,0x20,0xF5,0xFF,0x6C,0x80,0xFA,0x7F,0xFF,0xC6,0x6,0xC1,0x1,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x21,0x7,0xFF,0x5D,0xC,0x78,0x58,0x24,0x78,0xFF,0xC6,0x3,0xC1,0x5,0xDA,0x3E,0x48,0x90,0x21,0x28,0x91,0x21,0x32,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0xF,0xDA,0x3E,0x48,0xFF,0xC0,0x1,0x64,0xC,0x7F,0x60,0x80,0x96,0x7F,0xFF,0x58,0x60,0x7F,0xFF,0xC6,0x6,0xC1,0xF,0xDA,0x3D,0xF4,0x90,0x21,0x41,0xFF,0x5F,0xA,0x7F,0x6B,0x10,0x7F,0xFF,0xC6,0x4,0xC1,0xF,0xCC,0x1E,0xFC,0xC,0x3F,0x90,0x21,0x5B,0x91,0x21,0x64,0x92,0x21,0x60,0xFF,0x54,0x82,0x26,0x0,0xFF,0xC0,0x4,0xC2,0xF4,0x5B,0x4F,0x5D,0x5C,0x41,0x63,0x5D,0x36,0x65,0x5E,0x31,0x6D,0x64,0xE,0x71,0x66,0x3B,0x7B,0x60,0x27,0x69,0x63,0x60,0x5C,0x60,0xE,0x64,0x64,0xB,0x69,0x67,0x31,0x74,0xFF,0xC6,0x4,0xC1,0xF,0xCC,0x1E,0xFC,0xC,0x3F,0xDA,0x3E,0x7C,0x90,0x21,0x9C,0x91,0x21,0xA5,0x92,0x21,0xA1,0xFF,0x58,0x81,0x2C,0x7F,0xFF,0xC0,0x4,0xC2,0xF4,0x6E,0xE,0x74,0x6C,0xB,0x79,0x70,0x12,0x65,0x69,0xF,0x6D,0x6B,0x80,0xFA,0x71,0xFF,0xC6,0x5,0xC1,0x0,0xCC,0x7F,0xFC,0xC,0x3F,0x90,0x21,0xC9,0x91,0x21,0xC9,0x92,0x21,0xCD,0xFF,0x71,0x3A,0x7F,0xFF,0xC0,0xA,0x70,0x30,0x55,0xFF,0xC6,0x6,0xC1,0xA,0xDA,0x3D,0xC4,0x90,0x21,0xDE,0xFF,0xC7,0x81,0x33,0x60,0x7A,0x40,0x64,0xFF,0xC6,0x6,0xC1,0xA,0xDA,0x3D,0xC4,0x90,0x21,0xF1,0xFF,0xC7,0x82,0x33,0x60,0x7A,0x40,0x64,0xFF,0xC6,0x6,0xC1,0x1,0xCC,0x37,0xFC,0xC,0x3F,0x90,0x22,0x6,0xFF,0x5B,0x7,0x7F,0x4F,0x12,0x7F,0xFF,0xC6,0x4,0xC1,0xE,0x90,0x22,0x15,0xFF,0xC7,0x81,0x2B,0x7F,0x5F,0x7F,0x73,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0x90,0x22,0x2F,0xD9,0x32,0x91,0x22,0x2D,0xFF,0xC0,0x4,0xC2,0x18,0x5F,0xC,0x64,0x62,0xC,0x64,0x6B,0xC,0x64,0x67,0xC,0x64,0x69,0xC,0x64,0x6E,0x18,0x64,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x22,0x4C,0xFF,0xFC,0x22,0x51,0xC2,0xFC,0x5B,0x5,0x69,0xC7,0x81,0xF,0xFF,0x48,0xA,0x64,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x22,0x64,0xFF,0x48,0x5,0x7F,0x52,0x12,0x7F,0xFF,0xC6,0x4,0xC1,0x9,0xDA,0x3E,0xAC,0x90,0x22,0x76,0xFF,0xC7,0x82,0x5,0xFF,0x48,0xA,0x7F,0xFF,0xC6,0x0,0xC1,0x0,0x90,0x22,0x86,0xFF,0x6C,0x6,0x64,0xC7,0x81,0x2C,0xFF,0x60,0x12,0x64,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0x90,0x22,0x9C,0xFF,0xC2,0xC,0xC7,0x85,0x3E,0xFF,0x66,0x78,0x5D,0xFF,0xC6,0x1,0xC1,0x1,0x90,0x22,0xAE,0xFF,0x5D,0xC,0x7F,0xFF,0xC6,0x4,0xC1,0x1,0x90,0x22,0xBF,0x91,0x22,0xBD,0xFF,0xC0,0x1,0x62,0x6,0x7F,0x61,0x7,0x7F,0x61,0x6,0x7F,0x62,0x6,0x7F,0xFF,0xC6,0x6,0xDA,0x3D,0xC4,0x90,0x22,0xE3,0xCC,0x1,0xFC,0xC,0x26,0xDA,0x3D,0xC4,0x91,0x22,0xEE,0x92,0x22,0xEA,0xFF,0xC6,0xA,0xC2,0x18,0xFB,0x22,0xF0,0xC0,0x2,0xC2,0xC,0xC6,0x0,0xC7,0x83,0x3,0xFF,0x4F,0x30,0x64,0x51,0x2C,0x64,0x53,0x28,0x64,0x54,0x24,0x64,0x56,0x20,0x64,0x58,0x1C,0x64,0x5A,0x18,0x64,0x5B,0x14,0x64,0x5D,0x11,0x64,0x5F,0xE,0x64,0x60,0xC,0x64,0x62,0xA,0x64,0xFB,0x23,0x15,0xFF,0xC6,0x4,0xC1,0xE,0x90,0x22,0x15,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0xF,0xDA,0x3E,0xDC,0x91,0x1E,0x76,0xCC,0x64,0xFC,0xC,0x26,0xC6,0x4,0xC1,0xE,0x90,0x23,0x3F,0xFF,0xC2,0xFA,0xC7,0x81,0x2B,0x7F,0x5F,0x80,0xFA,0x73,0xFF,0xC6,0x4,0xC1,0xF,0x90,0x23,0x57,0x91,0x23,0x55,0xFF,0xC2,0x2,0x67,0xC,0x7F,0xFB,0x1E,0x4B,0xC6,0x4,0xC1,0xE,0x90,0x23,0x65,0xFF,0xC7,0x83,0x27,0x80,0x6A,0x2D,0x73,0x6A,0x2D,0x73,0x6A,0x2D,0x73,0x6C,0x7F,0x73,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x1E,0xFC,0xC,0x3F,0x90,0x23,0x83,0xFF,0xC2,0xC,0xC7,0x83,0x3,0xFF,0x5B,0xA,0x55,0x60,0xA,0x55,0x67,0xA,0x55,0x6C,0xA,0x55,0x73,0xA,0x55,0x78,0xA,0x55,0x73,0xA,0x2D,0x78,0xA,0x23,0xFF,0xC6,0x5,0xC1,0x7,0x90,0x23,0xB3,0xFD,0x1,0xC6,0x4,0xC1,0x9,0x91,0x20,0x32,0xFF,0xC7,0x1,0x1B,0x28,0x60,0x32,0x78,0xFF,0xC6,0x6,0xC1,0xB,0x90,0x38,0xBA,0xCC,0x9,0xFC,0xC,0x26,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x44,0x90,0x38,0x21,0xFF,0xC6,0x4,0xC1,0x9,0x90,0x20,0x34,0xCC,0xC,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x1,0x90,0x23,0xE6,0xFF,0xC7,0x82,0xF,0xFF,0x5F,0x14,0x7F,0xFF,0xC1,0x80,0xDA,0x3E,0x68,0x90,0x24,0x2,0x91,0x23,0xFD,0x92,0x24,0x4,0xFF,0xC2,0x7,0xFB,0x24,0x6,0xC0,0x6,0xC2,0xC,0x2E,0xC,0x5A,0x14,0x2D,0xC,0x5A,0x14,0x2E,0xC,0x5A,0x14,0x3A,0x10,0x64,0x50,0x3A,0x10,0x3C,0x50,0x3A,0x10,0x28,0x50,0x3A,0x10,0x19,0x50,0xC0,0xA,0xFF,0xC6,0x5,0xC1,0xD,0xDA,0x3E,0xCC,0xCC,0x14,0xFC,0xC,0x3F,0xCC,0x7F,0x77,0x90,0x24,0x5A,0x91,0x24,0x81,0x92,0x24,0x7D,0xCC,0x4,0xFC,0xC,0x26,0x87,0xC8,0x1,0xFA,0x24,0x52,0x77,0xC7,0x0,0x24,0x4E,0xE0,0x7F,0xFB,0x24,0x3D,0xCC,0x7F,0xFC,0xC,0x26,0xFB,0x24,0x52,0xC6,0x9,0x68,0x6,0x7A,0x69,0x4,0x70,0x6B,0x5,0x6D,0x6C,0x6,0x7C,0x6C,0x4,0x74,0x6D,0x7,0x72,0xC0,0x19,0x6B,0x7F,0x7A,0x6B,0xA,0x7F,0x6B,0x64,0x72,0xFB,0x24,0x70,0xFF,0xC2,0x4,0xC0,0x2,0xC7,0x83,0x27,0xFF,0xF8,0x2,0x77,0x6,0x78,0x7C,0x9,0x70,0xC0,0x4,0xF7,0x78,0x5,0x7D,0x7E,0xA,0x6D,0xC0,0x5,0x78,0x6,0x7B,0x7E,0x7,0x77,0xC0,0x8,0xF8,0xA,0x79,0x5,0x78,0x7E,0x8,0x78,0xC0,0x5,0xF7,0xF8,0xA,0x7B,0x7,0x73,0x7C,0x7,0x71,0xC0,0x2,0xF7,0xF8,0xA,0x77,0x8,0x73,0x7A,0x6,0x71,0xC0,0x5,0xF7,0xFB,0x24,0xA0,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x28,0xFC,0xC,0x3F,0xDA,0x3E,0x34,0x90,0x24,0xD5,0xFF,0xF8,0x2,0x7E,0x6,0x6E,0x7E,0x2,0x2D,0x7A,0x6,0x6E,0x7A,0x2,0x2D,0xF7,0xFF,0xC6,0x7,0xC1,0x1,0x90,0x24,0xFB,0x91,0x24,0xF9,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x5,0xC1,0x5,0xFF,0xC2,0xFA,0x4F,0xC,0x7F,0x51,0x3A,0x7F,0xFF,0xC6,0x5,0xC1,0xE,0x90,0x25,0xA,0xFF,0xC7,0x82,0x28,0x7F,0x66,0x28,0x64,0xFF,0xC6,0x5,0xC1,0xE,0x90,0x25,0x1A,0xFF,0xC7,0x82,0x2B,0x7F,0x67,0x36,0x64,0xFF,0xFB,0x2E,0x8C,0xFB,0x2D,0xFA,0xC6,0x0,0xC1,0x3,0x90,0x25,0x30,0xFF,0x67,0x32,0x7F,0xFF,0xC6,0x6,0xC1,0x2,0x90,0x25,0x3F,0x91,0x25,0x3F,0xFF,0xC2,0x7,0xFC,0x25,0x46,0xC2,0xFE,0xC7,0x83,0x1F,0xFF,0x73,0x6,0x7F,0x78,0xC,0x7F,0xFF,0xC6,0x9,0xC1,0x6,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x25,0x61,0x91,0x25,0x61,0xFF,0xC7,0x82,0x27,0xFF,0x5F,0x60,0x64,0xFF,0xC6,0x4,0xC1,0xE,0x90,0x25,0x74,0x91,0x25,0x78,0xFF,0xC2,0x3,0xC0,0x5,0xC4,0xC7,0x85,0x1F,0xFF,0x62,0x81,0x2C,0x7F,0xFF,0xC6,0x4,0xC1,0xE,0xDA,0x3E,0x48,0x90,0x25,0x9B,0xCC,0x1,0xFC,0xC,0x26,0xDA,0x3E,0x48,0x91,0x25,0xA5,0x92,0x25,0xA3,0xFF,0xC7,0x81,0x20,0x40,0x66,0x46,0x7F,0xFF,0xC0,0x4,0xC0,0x4,0xC7,0x81,0x24,0x28,0x69,0xC,0x7F,0xFF,0xC6,0x4,0xC1,0x2,0x90,0x25,0xBC,0x91,0x25,0xBA,0xFF,0xC2,0xC,0xC7,0x81,0x7,0xFF,0x4F,0x3C,0x7F,0xC7,0x81,0x14,0xC8,0x47,0x5A,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xD8,0x46,0xD7,0x46,0xDA,0x3D,0xD4,0x90,0x25,0xE6,0x91,0x25,0xE4,0xCC,0x23,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC2,0x1,0xC7,0x81,0x13,0xFF,0x5F,0x32,0x73,0xFF,0x26,0x3E,0x26,0x3E,0x26,0x58,0x26,0x68,0x26,0x68,0x26,0x78,0x26,0xC8,0x26,0xE0,0x26,0xFA,0x27,0xA,0x27,0x41,0x27,0x5A,0x27,0x6D,0x27,0xB6,0x27,0xC8,0x27,0xE5,0x27,0xFF,0x35,0x12,0x28,0x3D,0x28,0x55,0x28,0x6A,0x28,0x7C,0x28,0xB3,0x28,0xFA,0x29,0x15,0x29,0x30,0x26,0x58,0x26,0x68,0x26,0x3E,0x26,0x3E,0x26,0x3E,0x26,0x3E,0x1B,0xA2,0x22,0x6B,0x26,0x58,0x26,0x68,0x26,0x3E,0x26,0x3E,0x26,0x3E,0x26,0x3E,0xC6,0x5,0xC1,0x1,0xCC,0x19,0xFC,0xC,0x3F,0xDA,0x3D,0xB4,0x90,0x26,0x4E,0xFF,0xC4,0xC0,0x4,0x69,0x81,0x2C,0x5F,0xFB,0x26,0x51,0xC6,0x5,0xC1,0x2,0x90,0x26,0x60,0xFF,0xC4,0x67,0x81,0x2C,0x5A,0xFB,0x26,0x61,0xC6,0x5,0xC1,0x3,0x90,0x26,0x70,0xFF,0xC4,0x6C,0x81,0x2C,0x69,0xFB,0x26,0x71,0xC6,0x5,0xC1,0x6,0xD9,0xD,0x90,0x26,0x85,0x91,0x26,0x87,0xFF,0xC2,0xF4,0xC4,0xC7,0x85,0x27,0xFF,0x6C,0x18,0x6E,0x66,0x3C,0x6E,0x6F,0xA,0x6E,0x71,0x32,0x6E,0x68,0x4B,0x6E,0x65,0x14,0x6E,0x6E,0xC,0x6E,0x70,0x1F,0x6E,0x77,0x18,0x6E,0x6E,0x40,0x6E,0x64,0xC,0x6E,0x67,0xA,0x6E,0x64,0xE,0x6E,0x67,0xC,0x6E,0x60,0x54,0x6E,0x67,0xA,0x6E,0x64,0x2B,0x6E,0x69,0x60,0x6E,0x67,0x22,0x6E,0xFB,0x26,0x8C,0xC6,0x3,0xC1,0x2,0x90,0x26,0xD0,0xFF,0xC4,0xC7,0x85,0x24,0xFF,0x62,0x81,0x2C,0x5F,0x64,0x81,0x2C,0x5F,0xFB,0x26,0xD5,0xC6,0x6,0xC1,0xF,0x90,0x26,0xE8,0xFF,0xC4,0x6B,0xC,0x7F,0xC7,0x81,0x2C,0xFF,0x6B,0x50,0x7F,0x6B,0x81,0x2C,0x7F,0xFB,0x26,0xF3,0xC6,0x5,0xC1,0x2,0x90,0x27,0x2,0xFF,0xC4,0x5B,0x81,0x2C,0x64,0xFB,0x27,0x3,0xC6,0x4,0xC1,0x5,0xDA,0x3D,0xD4,0xD9,0x19,0x90,0x27,0x17,0xFF,0xC2,0x6,0xC7,0x85,0x27,0xFF,0x67,0x18,0x7F,0x5F,0x36,0x7F,0x6B,0xC,0x7F,0x64,0x32,0x7F,0x5B,0x50,0x7F,0x64,0x37,0x7F,0x62,0x40,0x7F,0x60,0x3D,0x7F,0x5D,0x4A,0x7F,0x60,0x31,0x7F,0x66,0x1F,0x7F,0xFB,0x27,0x1D,0xC6,0x6,0xC1,0xF,0x90,0x27,0x49,0xFF,0xC4,0xC7,0x85,0x27,0xFF,0x6A,0x3C,0x7F,0x69,0x3C,0x7F,0x6A,0x3C,0x7F,0xFB,0x27,0x51,0xC6,0x4,0xC1,0x2,0xD9,0x1E,0x90,0x27,0x64,0xFF,0xC7,0x81,0xF,0xFF,0x4B,0x81,0xF4,0x7F,0xFF,0xC6,0x5,0xC1,0x5,0xDA,0x3E,0x58,0xCC,0x2D,0xFC,0xC,0x3F,0x90,0x27,0x7D,0xFF,0xFC,0x27,0x9E,0xC0,0xB,0xFC,0x27,0x9E,0xC0,0x9,0xFC,0x27,0x9E,0xC0,0x8,0xFC,0x27,0x9E,0xC0,0x6,0xFC,0x27,0x9E,0xC0,0x5,0xFC,0x27,0x9E,0xC0,0x3,0xFB,0x27,0x96,0xC2,0x0,0xC6,0x4,0x56,0x6,0x7F,0xC2,0x24,0xC6,0x5,0xC4,0xC7,0x85,0x33,0xFF,0x69,0x5,0x4D,0xC0,0x4,0xC8,0xC5,0xFF,0xC6,0x4,0xC1,0x2,0x90,0x27,0xBE,0xFF,0xC7,0x81,0x13,0xA,0x48,0x9,0x7F,0xFB,0x27,0xBE,0xC6,0x3,0xC1,0x7,0xD9,0x5,0x90,0x27,0xDD,0x91,0x27,0xD5,0xFF,0xC4,0x6F,0x81,0xF4,0x5A,0xFB,0x27,0xD6,0xC4,0x6E,0x81,0xF4,0x5A,0xFB,0x27,0xDE,0xC6,0x4,0xC1,0x2,0xD9,0x1E,0x90,0x27,0xF4,0x91,0x27,0xF2,0xFF,0xC2,0x6,0xC7,0x85,0x7,0xFF,0x4D,0x80,0x46,0x78,0xFB,0x27,0xF4,0xC6,0x5,0xC1,0x6,0xD9,0xD,0x90,0x28,0xC,0x91,0x28,0xE,0xFF,0xC2,0xFA,0xC4,0xC7,0x85,0x22,0xFF,0x73,0x18,0x6E,0x6B,0x63,0x6E,0x6F,0xA,0x6E,0x71,0x32,0x6E,0x69,0x4B,0x6E,0x6E,0xC,0x6E,0x70,0x1F,0x6E,0x77,0x7F,0x6E,0x6E,0x63,0x6E,0x6B,0xA,0x6E,0x67,0xC,0x6E,0x69,0x60,0x6E,0x67,0x22,0x6E,0xFB,0x28,0x13,0xC6,0x4,0xC1,0x2,0xC6,0x6,0xDA,0x3E,0x4,0xD9,0xC8,0x90,0x28,0x4C,0xFF,0xC2,0x3,0x3E,0x2,0x7F,0x7F,0xFB,0x28,0x4E,0xC6,0x3,0xC1,0x1,0xDA,0x3D,0xD4,0xD9,0xF,0x90,0x28,0x62,0xFF,0xC4,0x6C,0x81,0x2C,0x5F,0xFB,0x28,0x63,0xC6,0x4,0xC1,0xE,0x90,0x28,0x72,0xFF,0xC7,0x81,0x26,0x7F,0x67,0x9,0x7F,0xFB,0x28,0x72,0xCC,0x32,0xFC,0xC,0x3F,0xC6,0x4,0xC1,0xF,0x90,0x28,0xA0,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0xF,0x91,0x28,0xA8,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0xF,0xD9,0xA,0xFF,0x55,0xC,0x7F,0x52,0x82,0x26,0x7F,0xFF,0xC2,0x18,0xC7,0x82,0x13,0xFF,0x54,0x81,0xF4,0x7F,0xFF,0xC6,0x3,0xC1,0x2,0xDA,0x3D,0xD4,0x90,0x28,0xCF,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x4,0xC1,0x5,0xD9,0x14,0x91,0x28,0xDF,0x92,0x28,0xDD,0xFF,0xC2,0xF4,0xC4,0xC7,0x82,0x27,0xFF,0x6E,0xA7,0x10,0x50,0xFB,0x28,0xD6,0xC2,0x6,0xC7,0x83,0x14,0xFF,0x4F,0x5A,0x7F,0x60,0x2D,0x7F,0x5D,0x46,0x7F,0x58,0x78,0x7F,0x60,0x44,0x7F,0x58,0x74,0x7F,0xC2,0x7,0xFB,0x28,0xDF,0xC6,0x6,0xC1,0x1,0x90,0x29,0x7,0x91,0x29,0xD,0xD9,0x7F,0xFF,0x58,0xC,0x55,0xFB,0x29,0x7,0xC6,0xF,0x67,0x10,0x73,0xFB,0x29,0xF,0xC6,0x3,0xC1,0x6,0xDA,0x3D,0xD4,0x90,0x29,0x23,0x91,0x29,0x23,0xFF,0xC7,0x81,0x26,0x50,0xC4,0x63,0x81,0x2C,0x64,0xFB,0x29,0x28,0xFF,0xC6,0x5,0xC1,0xF,0xDA,0x3D,0xD4,0xD9,0x8,0x90,0x29,0x3D,0xFF,0xC4,0xC7,0x82,0x14,0xFF,0x6B,0x9B,0x58,0x3F,0xFB,0x29,0x42,0x1C,0x38,0x2A,0x5C,0x2A,0x78,0x2A,0x88,0x2A,0xA7,0x2A,0xBF,0x2A,0xDB,0x2A,0xED,0x2A,0xF9,0x2B,0x5,0x2B,0x15,0x2B,0x21,0x2B,0x30,0x2B,0x54,0x2B,0x61,0x2B,0x6E,0x2B,0x7A,0x2B,0x95,0x2B,0xA1,0x2B,0xAD,0x2B,0xB9,0x2B,0xC5,0x2B,0xD7,0x2B,0xF6,0x2C,0x2,0x2C,0x29,0x2C,0x35,0x2C,0x41,0x2C,0x53,0x2C,0x72,0x2C,0x89,0x2C,0x9C,0x2C,0xB3,0x2C,0xD1,0x2C,0xDF,0x2C,0xFA,0x2D,0xC,0x2D,0x1F,0x2D,0x30,0x2D,0x43,0x2D,0x5B,0x2D,0x72,0x2D,0x8E,0x2D,0xA0,0x2D,0xB2,0x2D,0xCD,0x2D,0xE1,0x2D,0xFA,0x2E,0x1C,0x2E,0x38,0x2E,0x5C,0x2E,0x79,0x2E,0x8C,0x2E,0x9D,0x2E,0xAB,0x2E,0xBB,0x2E,0xDA,0x2E,0xF3,0x2F,0x3,0x2F,0x1A,0x2F,0x2A,0x2F,0x3C,0x2F,0x54,0x2F,0x69,0x2F,0x7D,0x2F,0x8D,0x2F,0xB5,0x2F,0xCF,0x2F,0xDD,0x2F,0xED,0x30,0x3,0x30,0x13,0x30,0x2C,0x30,0x3D,0x30,0x4D,0x30,0x6B,0x30,0x7B,0x30,0xA2,0x30,0xB6,0x30,0xD6,0x3C,0x95,0x3C,0xCD,0x3D,0x3,0x3D,0x37,0x30,0xF9,0x31,0xC,0x31,0x1F,0x31,0x58,0x31,0x6C,0x31,0xA4,0x31,0xB7,0x31,0xCA,0x31,0xDA,0x31,0xF5,0x32,0x6C,0x32,0x5,0x32,0x21,0x32,0x31,0x32,0x4C,0x32,0x5C,0x32,0x7C,0x32,0x83,0x32,0x97,0x32,0xB6,0x32,0xD7,0x32,0xE4,0x32,0xF7,0x33,0xB,0x33,0x22,0x33,0x41,0x33,0x60,0x33,0x8B,0x33,0xC2,0x33,0xDE,0x33,0xF9,0x34,0x1D,0x34,0x3D,0x2A,0xBF,0x2A,0xDB,0x2A,0xED,0x2F,0x7D,0x2F,0x8D,0x2A,0x78,0x2A,0x88,0x2A,0xA7,0x2A,0xBF,0x2A,0xDB,0x2A,0xED,0xC6,0x6,0xC1,0x5,0x90,0x2A,0x51,0xFF,0x5B,0x8,0x5A,0xC7,0x81,0x2B,0xFF,0x5B,0x21,0x5A,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2A,0x6D,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x0,0xFF,0x6B,0xF,0x5A,0xC7,0x82,0x1B,0xFF,0x64,0xB,0x5A,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x2A,0x80,0xFF,0xC7,0x81,0x2B,0xFF,0x70,0x30,0x6E,0xFF,0xC6,0x6,0xC1,0x1,0xCC,0x3C,0xFC,0xC,0x3F,0x90,0x2A,0x98,0x91,0x2A,0xA1,0xFF,0x64,0x8,0x78,0x63,0x28,0x78,0xC0,0x30,0xFF,0xC0,0x18,0x40,0x1E,0x5F,0xFF,0xC6,0x6,0xC1,0x2,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x2A,0xBB,0x91,0x2A,0xB7,0xFF,0xC0,0x3,0xC2,0x5,0x67,0x7F,0x7F,0xFF,0xC6,0x6,0xC1,0x2,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x2A,0xD3,0x91,0x2A,0xCF,0xFF,0xC0,0x3,0xC2,0x5,0xC7,0x81,0x2D,0xFF,0x61,0x30,0x7F,0xFF,0xC6,0x6,0xC1,0x4,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x2A,0xE8,0xFF,0x60,0x81,0x4,0x7F,0xFF,0xC6,0x6,0xC1,0x5,0x90,0x2A,0xF5,0xFF,0x60,0x28,0x7F,0xFF,0xC6,0x6,0xC1,0x6,0x90,0x2B,0x1,0xFF,0x64,0x5A,0x7F,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x2B,0xD,0xFF,0xC7,0x81,0x27,0xFF,0x64,0x26,0x64,0xFF,0xC6,0x6,0xC1,0x8,0x90,0x2B,0x1D,0xFF,0x67,0x18,0x7F,0xFF,0xC6,0x6,0xC1,0x9,0x90,0x2B,0x29,0xFF,0x72,0xA,0x7F,0x77,0xA,0x7F,0xFF,0xC6,0x7,0xC1,0xC,0xCC,0x37,0xFC,0xC,0x3F,0x90,0x2B,0x50,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x1,0x91,0x2B,0x49,0xFF,0x65,0xC,0x7F,0x5F,0x1E,0x7F,0xFF,0x5F,0x2A,0x7F,0xFF,0xC6,0x6,0xC1,0xA,0x90,0x2B,0x5C,0xFF,0x67,0x80,0xD2,0x7F,0xFF,0xC6,0x6,0xC1,0xB,0x90,0x2B,0x69,0xFF,0x67,0x80,0xD2,0x7F,0xFF,0xC6,0x6,0xC1,0xC,0x90,0x2B,0x76,0xFF,0x67,0x24,0x7F,0xFF,0xC6,0x6,0xC1,0xB,0x90,0x2B,0x82,0xFF,0xC7,0x81,0x21,0xFF,0x79,0x4,0x7F,0xC2,0xFC,0xC7,0x81,0x39,0xFF,0x61,0x6,0x7F,0xC0,0x14,0xFF,0xC6,0x6,0xC1,0xE,0x90,0x2B,0x9D,0xFF,0x67,0x48,0x6E,0xFF,0xC6,0x4,0xC1,0x5,0x90,0x2B,0xA9,0xFF,0x7B,0x24,0x69,0xFF,0xC6,0x6,0xC1,0xF,0x90,0x2B,0xB5,0xFF,0x67,0x4C,0x7F,0xFF,0xC6,0x7,0xC1,0x0,0x90,0x2B,0xC1,0xFF,0x67,0x18,0x69,0xFF,0xC6,0x6,0xC1,0x1,0x90,0x2B,0xCD,0xFF,0xC7,0x81,0x2C,0xFF,0x64,0x18,0x73,0xC0,0x32,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x2B,0xEB,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x1,0x91,0x2B,0xEF,0xFF,0x5F,0x26,0x7F,0xFF,0x66,0x8,0x7F,0x61,0x1E,0x7F,0xFF,0xC6,0x7,0xC1,0x1,0x90,0x2B,0xFE,0xFF,0x67,0x24,0x78,0xFF,0xC6,0x4,0xC1,0xF,0xDA,0x3E,0xDC,0x90,0x2C,0x17,0x91,0x2C,0x21,0x92,0x2C,0x1F,0xCC,0x1,0xD9,0xA,0xFF,0xC7,0x81,0x33,0xFF,0x54,0x2E,0x73,0xFF,0xC2,0x3,0xC6,0x5,0xC0,0xA,0x70,0x23,0x7F,0xFF,0xC6,0x7,0xC1,0x2,0x90,0x2C,0x31,0xFF,0x67,0xC,0x69,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2C,0x3D,0xFF,0x67,0x68,0x7F,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2C,0x49,0xFF,0xC7,0x82,0x26,0x7F,0x73,0x4,0x50,0xC0,0x1E,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x2C,0x5B,0xFF,0xC7,0x83,0x21,0xFF,0x28,0xF,0x7F,0x7F,0x5A,0x20,0x7F,0xFF,0xC7,0x83,0x1B,0xFF,0x56,0x9,0x7F,0x58,0x1C,0x7F,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2C,0x7A,0xFF,0xC7,0x81,0x1B,0xFF,0x70,0x9,0x64,0xC7,0x81,0x1B,0xFF,0x70,0x5,0x64,0xFF,0xC6,0x6,0xC1,0x5,0x90,0x2C,0x91,0xFF,0x64,0x8,0x5A,0xC7,0x81,0x2B,0xFF,0x5B,0x14,0x5A,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x2C,0xA4,0xFF,0xC7,0x81,0x27,0xFF,0x6C,0xC,0x6E,0xC7,0x81,0x2E,0xFF,0x7A,0x30,0x6E,0xFF,0xC6,0x6,0xC1,0xC,0x90,0x2C,0xC4,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x0,0xC1,0x4,0xFF,0xC7,0x82,0x18,0xFF,0x4C,0x4,0x64,0x73,0x8,0x50,0xC0,0x1E,0xFF,0xC6,0x7,0xC1,0x7,0xD9,0xF,0x90,0x2C,0xDB,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0xCC,0xA,0xFC,0xC,0x3F,0x90,0x2C,0xEF,0xFF,0xC7,0x85,0x30,0xFF,0x7C,0x7,0x73,0x67,0x23,0x73,0xFF,0xC6,0x4,0xC1,0xD,0x90,0x2D,0x2,0xFF,0xC7,0x81,0x1B,0xFF,0x43,0x14,0x73,0xC0,0x1E,0xFF,0xC6,0x7,0xC1,0x0,0x90,0x2D,0x14,0xFF,0x6B,0x6,0x69,0xC7,0x81,0x20,0xFF,0x6C,0x18,0x69,0xFF,0xC6,0x7,0xC1,0x3,0xCC,0xF,0xFC,0xC,0x3F,0x90,0x2D,0x2C,0xFF,0x70,0x55,0x7F,0xFF,0xC6,0x7,0xC1,0x8,0x90,0x2D,0x38,0xFF,0x6C,0xC,0x64,0xC7,0x81,0x2C,0xFF,0x60,0x18,0x69,0xFF,0xC6,0x9,0xC1,0x1,0xDA,0x3D,0xC4,0x90,0x2D,0x4E,0xFF,0xC7,0x83,0x2E,0xFF,0x5B,0x5,0x7F,0x60,0x3,0x7F,0xC0,0x22,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0x90,0x2D,0x66,0xFF,0xC4,0xC7,0x85,0x3E,0xFF,0x72,0x24,0x5D,0x5A,0x3C,0x5D,0xFF,0xC6,0x4,0xC1,0x5,0x90,0x2D,0x83,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x2,0xC1,0x0,0xFF,0x7E,0x4,0x69,0xC7,0x81,0x2B,0xC8,0x64,0x4E,0x7F,0xFF,0xC6,0x3,0xC1,0x5,0xDA,0x3D,0xC4,0x90,0x2D,0x99,0xFF,0x69,0x6,0x64,0x58,0x1C,0x64,0xFF,0xC6,0x3,0xC1,0x5,0xDA,0x3D,0xC4,0x90,0x2D,0xAB,0xFF,0x64,0x5,0x64,0x6C,0x18,0x64,0xFF,0xC6,0x0,0xC1,0x4,0xDA,0x3D,0xC4,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x2D,0xC2,0xFF,0xC4,0xC7,0x81,0x27,0xFF,0x7E,0x1B,0x6B,0xC0,0x12,0xFF,0xC6,0x7,0xC1,0xA,0x90,0x2D,0xD5,0xFF,0xC4,0xC7,0x85,0x29,0xFF,0x6D,0x28,0x7F,0x69,0xF,0x7F,0xFF,0xC6,0x7,0xC1,0xB,0xDA,0x3D,0xC4,0x90,0x2D,0xEE,0xFF,0xC2,0xF4,0xC4,0xC7,0x85,0x27,0xFF,0x60,0xC,0x7F,0x67,0x60,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xCC,0x14,0xFC,0xC,0x3F,0xDA,0x3E,0xDC,0x90,0x2E,0xA,0xFF,0xC2,0xE8,0xC4,0xC7,0x85,0x19,0xFF,0x43,0xF,0x55,0xC2,0x0,0x73,0x1C,0x55,0xC0,0x19,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0x90,0x2E,0x27,0xFF,0xC2,0xFD,0xC4,0xC7,0x85,0x18,0xFF,0x51,0xA,0x64,0x60,0xA,0x64,0x5B,0x6,0x64,0xFF,0xC6,0x6,0xC1,0x5,0xDA,0x3D,0xC4,0x90,0x2E,0x43,0xFF,0xC2,0xA,0xFC,0x2E,0x4E,0xFC,0x2E,0x4E,0xC0,0x14,0xFF,0xC7,0x85,0x34,0xFF,0x70,0x4,0x73,0x74,0x2,0x73,0xC0,0x2,0xC8,0xFF,0xC6,0x2,0x90,0x2E,0x65,0x91,0x2E,0x6F,0xFF,0xC6,0x0,0xC7,0x82,0x2C,0xFF,0x6B,0x54,0x64,0xFF,0xC6,0x1,0xC7,0x82,0x20,0xFF,0x5F,0x54,0x64,0xFF,0xC6,0x3,0xC1,0x0,0xDA,0x3E,0x14,0x90,0x2E,0x84,0xFF,0xC7,0x81,0x3E,0xFF,0x66,0x7F,0x75,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2E,0x94,0xFF,0x5B,0x6,0x64,0x5D,0x3,0x46,0xC0,0x1E,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2E,0xA5,0xFF,0x54,0x4,0x64,0xC0,0x1E,0xFF,0xC6,0x7,0xC1,0x3,0x90,0x2E,0xB3,0xFF,0xC7,0x82,0x1D,0xFF,0x6E,0xC,0x50,0xFF,0xC6,0x6,0xC1,0x4,0xDA,0x3D,0xE4,0x90,0x2E,0xC8,0xFF,0xC2,0xC,0xC4,0xC7,0x85,0x24,0xFF,0x70,0x8,0x64,0x6D,0x4,0x64,0x70,0xA,0x64,0x69,0x48,0x64,0xFF,0xC6,0x6,0xC1,0x9,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x2E,0xEA,0x91,0x2E,0xEA,0xFF,0xC7,0x81,0x14,0xFF,0x5A,0x81,0x2C,0x7F,0xFF,0xC6,0x7,0xC1,0x7,0x90,0x2E,0xFB,0xFF,0xC7,0x81,0x20,0xDD,0x62,0xA,0x73,0xFF,0xC6,0x7,0xC1,0x7,0x90,0x2F,0xB,0xFF,0xC7,0x81,0x22,0xDD,0x66,0xC,0x7F,0xC7,0x82,0x22,0xDD,0x67,0x12,0x7F,0xFF,0xC6,0x1,0xC1,0x1,0x90,0x2F,0x22,0xFF,0xC7,0x81,0x3A,0xFF,0x74,0x6,0x69,0xFF,0xC6,0x0,0xC1,0x1,0xDA,0x3D,0xC4,0x90,0x2F,0x35,0xFF,0x6B,0x6,0x5A,0x6C,0x6,0x5A,0xFF,0xC6,0x7,0xC1,0x8,0x90,0x2F,0x44,0xFF,0xC2,0xF8,0xFC,0x2F,0x49,0xC7,0x85,0x2C,0xFF,0x73,0x9,0x64,0x67,0xC,0x64,0xFF,0xC6,0x7,0xC1,0x8,0x90,0x2F,0x5C,0xFF,0xC2,0xA,0xC7,0x83,0x20,0xFF,0x67,0x6,0x69,0x5B,0x12,0x69,0xFF,0xC6,0x7,0xC1,0x9,0x90,0x2F,0x71,0xFF,0xC4,0xC7,0x83,0x27,0xFF,0x69,0x6,0x7F,0x65,0x24,0x7F,0xFF,0xC6,0x7,0xC1,0x9,0x90,0x2F,0x85,0xFF,0xC7,0x81,0x30,0xFF,0x68,0x24,0x7F,0xFF,0xC6,0x7,0xC1,0x9,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x2F,0x9A,0xFF,0xC2,0xFB,0xFC,0x2F,0xAA,0xC0,0xB,0xC2,0xF8,0xFC,0x2F,0xAA,0xC0,0xA,0xC2,0xF6,0xC7,0x85,0x1D,0xFF,0x58,0x2,0x7F,0x69,0x10,0x7F,0xFF,0xC6,0x7,0xC1,0x9,0xCC,0x14,0xFC,0xC,0x3F,0x90,0x2F,0xC2,0xFF,0xC2,0xF4,0xC7,0x85,0x19,0xFF,0x67,0x4,0x7F,0x5D,0x30,0x7F,0xFF,0xC6,0x7,0xC1,0x2,0x90,0x2F,0xD7,0xFF,0x6C,0x4,0x7F,0xC0,0x14,0xFF,0xC6,0x9,0xC1,0x3,0x90,0x2F,0xE5,0xFF,0xC7,0x81,0x18,0xFF,0x75,0x12,0x50,0xFF,0xC6,0x7,0xC1,0xA,0xDA,0x3E,0x34,0x90,0x2F,0xF8,0xFF,0x72,0x8,0x69,0xC7,0x82,0x2E,0xFF,0x72,0x30,0x69,0xFF,0xC6,0x6,0xC1,0x1,0x90,0x30,0xB,0xFF,0xC7,0x81,0x1B,0xFF,0x6B,0x1E,0x7F,0xFF,0xC6,0x5,0xC1,0x7,0x90,0x30,0x27,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0xC,0x91,0x31,0xD2,0xFF,0x62,0x80,0xAF,0x7F,0xFF,0xC6,0x6,0xC1,0x9,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x30,0x39,0xFF,0x77,0x32,0x7F,0xFF,0xC6,0x7,0xC1,0x7,0x90,0x30,0x45,0xFF,0xC7,0x82,0x33,0x7F,0x70,0x6,0x7F,0xFF,0xC6,0x6,0xC1,0x2,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x30,0x5F,0x91,0x30,0x5D,0xFF,0xC0,0x4,0xC4,0xC7,0x85,0x1F,0xFF,0x62,0x18,0x7F,0x51,0x48,0x7F,0xFF,0xC6,0x4,0xC1,0xF,0x90,0x30,0x78,0x91,0x30,0x76,0xFF,0xC2,0x4,0xFB,0x1C,0xB6,0xC6,0x9,0xC1,0x3,0xCC,0x18,0xFC,0xC,0x3F,0xDA,0x3F,0x18,0xD8,0x50,0xD7,0x3C,0x90,0x30,0x96,0xCC,0x1E,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC4,0xC7,0x85,0xF,0xFF,0x43,0x7,0x64,0x64,0x18,0x64,0xFF,0xC6,0x6,0xC1,0x0,0xDA,0x3D,0xC4,0x90,0x30,0xAD,0xFF,0xC4,0xC7,0x81,0x2C,0xFF,0x73,0x8,0x76,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x30,0xC7,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x2,0xFF,0xC7,0x81,0x3,0xFF,0x67,0x5,0x7F,0xC7,0x81,0x1B,0xFF,0x71,0x6,0x7F,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x30,0xE7,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x2,0xC1,0x1,0xFF,0xC7,0x81,0x3,0xFF,0x67,0x5,0x7F,0xC7,0x83,0x24,0xFF,0x70,0x6,0x5C,0x77,0x30,0x5C,0xFF,0xC6,0x3,0xC1,0x0,0xDA,0x3E,0x14,0x90,0x31,0x4,0xFF,0xC7,0x82,0x3E,0xFF,0x66,0x60,0x75,0xFF,0xC6,0x7,0xC1,0x5,0xDA,0x3D,0xE4,0x90,0x31,0x17,0xFF,0xC7,0x85,0x29,0xFF,0x64,0x18,0x7F,0xFF,0xFC,0x2B,0x7A,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0xD,0x91,0x31,0x50,0x92,0x31,0x54,0xCC,0xB,0xFC,0xC,0x26,0xFC,0x22,0x6B,0xCC,0x14,0xFC,0xC,0x26,0xC6,0x1,0xC1,0x4,0x90,0x31,0x46,0xFF,0x65,0x8,0x60,0x69,0x6,0x60,0x60,0x18,0x60,0xFF,0x6E,0x32,0x7F,0xFF,0x67,0x32,0x7F,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x31,0x60,0xFF,0xC7,0x83,0x1B,0xFF,0x22,0x12,0x7F,0x7F,0x54,0x28,0x7F,0xFF,0xC6,0x8,0xC1,0xC,0xD8,0x50,0xD7,0x5,0x90,0x31,0x7F,0xCC,0x58,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC7,0x83,0x2C,0xC8,0x31,0xC,0x7F,0x7F,0x28,0x12,0x7F,0x9B,0x27,0xB,0x7F,0x7F,0xC7,0x83,0x29,0xC8,0x33,0xA,0x7F,0x7F,0x30,0x12,0x7F,0x50,0x2E,0xA,0x7F,0x7F,0x30,0xB,0x7F,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0x90,0x31,0xAC,0xFF,0xC7,0x85,0x1F,0xFF,0x48,0x6,0x64,0x60,0xC,0x64,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x31,0xC2,0x91,0x31,0xC2,0xFF,0xC7,0x81,0x20,0xFF,0x56,0x24,0x6E,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x31,0xD2,0xFF,0xC7,0x81,0x1A,0xFF,0x53,0x60,0x7F,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x31,0xE2,0xFF,0xC2,0x3,0x1F,0x8,0x7F,0x46,0x1E,0x9,0x7F,0x46,0x1D,0x8,0x7F,0x46,0x1C,0x9,0x7F,0x46,0xFF,0xC6,0x6,0xC1,0xB,0x90,0x31,0xFD,0xFF,0xC7,0x81,0xC,0xFF,0x73,0x24,0x7F,0xFF,0xC6,0x6,0xC1,0x9,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x32,0x15,0x91,0x32,0x15,0xFF,0xC0,0x80,0xDC,0xC7,0x81,0x14,0xFF,0x5A,0x80,0xC8,0x6E,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x8,0x91,0x2D,0x38,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x8,0x91,0x32,0x41,0xFF,0x67,0xE,0x64,0xC7,0x81,0x27,0xFF,0x5B,0x1C,0x69,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x7,0x91,0x30,0x45,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x8,0x91,0x2F,0x5C,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0x0,0x91,0x2D,0x14,0xFF,0xFC,0x2D,0xE1,0x91,0x2D,0xEE,0xFF,0xFC,0x21,0xE,0xCC,0xC,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x1,0x92,0x32,0x93,0xFF,0x58,0x46,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xD8,0x50,0xD7,0x3C,0xDA,0x3D,0xD4,0x90,0x32,0xB2,0x91,0x32,0xB0,0xCC,0x38,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC2,0x1,0x4F,0x48,0x7F,0xFF,0xC6,0x4,0xC1,0xF,0xCC,0x28,0xFC,0xC,0x3F,0xDA,0x3E,0xAC,0x90,0x32,0xC6,0xFF,0xC7,0x84,0x3,0xFF,0x67,0x7,0x7F,0x6C,0x8,0x7F,0x73,0x7,0x7F,0x78,0x8,0x7F,0xFF,0xC6,0x6,0xC1,0x1,0xCC,0x37,0xFC,0xC,0x3F,0x90,0x2B,0x49,0xFF,0xC6,0x7,0xC1,0xC,0x90,0x32,0xEC,0xFF,0x5D,0x7,0x7F,0x1F,0x18,0x7F,0x7F,0x5B,0x26,0x7F,0xFF,0xC6,0x6,0xC1,0x0,0x90,0x32,0xFF,0xFF,0xC4,0xC7,0x85,0x20,0xFF,0x6E,0x9,0x50,0x64,0xA,0x5A,0xFF,0xC6,0x6,0xC1,0xB,0xDA,0x3D,0xF4,0x90,0x33,0x16,0xFF,0xC4,0xC7,0x85,0x13,0xFF,0x5F,0xE,0x7F,0x7E,0x8,0x7F,0xFF,0xC6,0x2,0xC1,0x1,0xDA,0x3D,0xB4,0x90,0x33,0x39,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x0,0x91,0x32,0xFF,0xFF,0xC7,0x81,0x2F,0xFF,0x72,0x18,0x73,0xFF,0xC6,0x4,0xC1,0x9,0xDA,0x3D,0xB4,0x90,0x33,0x4F,0x91,0x33,0x51,0xFF,0xC6,0xF,0xC2,0x6,0xFC,0x1C,0x9A,0xC2,0xF7,0xFC,0x1C,0x9A,0xC2,0xEC,0xFB,0x1C,0x9A,0xFC,0x30,0x13,0x91,0x33,0x86,0xCC,0x2,0xFC,0xC,0x26,0xC6,0x8,0xC1,0xA,0x92,0x33,0x73,0xFF,0xC7,0x83,0x2B,0xFF,0x6E,0x9,0x73,0xC4,0xC7,0x85,0x30,0xFF,0x72,0x8,0x7F,0x6C,0x1E,0x7F,0xFF,0xC2,0x2,0xFB,0x30,0x27,0xC6,0x7,0xC1,0xA,0xDA,0x3E,0x34,0x90,0x33,0x96,0xFF,0xC2,0x3,0xC7,0x81,0x2E,0xFF,0x77,0xA,0x69,0xFC,0x33,0xBA,0xC0,0xF,0xC7,0x81,0x2C,0xFF,0x35,0xF,0x69,0x7F,0xC7,0x81,0x2B,0xFF,0x73,0xC,0x69,0xC7,0x81,0x2E,0xFF,0x6B,0xE,0x69,0xC7,0x81,0x2B,0xFF,0x73,0xC,0x69,0xFF,0xC6,0x7,0xC1,0xA,0xDA,0x3E,0x34,0x90,0x33,0xCD,0xFF,0xC2,0x6,0xC7,0x83,0x35,0xFF,0x70,0x8,0x69,0x3C,0x9,0x69,0x64,0x67,0xB,0x69,0xFF,0xC6,0x6,0xC1,0x7,0x90,0x33,0xE6,0xFF,0xC2,0xFE,0x1F,0xA,0x7F,0x46,0x1E,0xB,0x7F,0x46,0x1D,0xA,0x7F,0x46,0x1C,0xC,0x7F,0x46,0xFF,0xFC,0x2D,0xB2,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x7,0xC1,0xA,0xDA,0x3E,0x34,0x91,0x34,0xC,0xFF,0xC2,0xC,0xC7,0x83,0x35,0xFF,0x70,0x8,0x69,0x3C,0x9,0x69,0x64,0x67,0x14,0x69,0xFF,0xFC,0x2B,0x7A,0xCC,0xA,0xFC,0xC,0x26,0xC6,0x9,0xC1,0x0,0xDA,0x3E,0xFC,0x90,0x34,0x30,0xFF,0xC2,0x6,0xC7,0x85,0xC,0xFF,0x40,0x12,0x7F,0x4A,0x14,0x7F,0xFF,0xC6,0x7,0xC1,0x0,0x90,0x34,0x4C,0x91,0x34,0x48,0xFF,0xC2,0x5,0xC0,0x3,0x6B,0x6,0x69,0xC7,0x81,0x20,0xFF,0x6C,0x8,0x69,0xC7,0x81,0x1D,0xFF,0x69,0xA,0x69,0xC7,0x81,0x1A,0xFF,0x66,0xD,0x69,0xC7,0x81,0x16,0xFF,0x62,0x10,0x69,0xFF,0x34,0xAC,0x34,0xBD,0x34,0xCE,0x34,0xEA,0x34,0xFE,0x35,0x12,0x35,0x26,0x35,0x38,0x35,0x4B,0x35,0x7C,0x35,0xFF,0x29,0x30,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x3D,0x37,0x34,0xBD,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xBD,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0x34,0xAC,0xC6,0x7,0xC1,0x5,0x90,0x34,0xB4,0xFF,0xC4,0x67,0x81,0x2C,0x7F,0xFB,0x34,0xB5,0xFF,0xC6,0x7,0xC1,0x6,0x90,0x34,0xC5,0xFF,0xC4,0x67,0x81,0x2C,0x5A,0xFB,0x34,0xC6,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3D,0xD4,0x90,0x34,0xD9,0xFF,0xC2,0xC,0xC4,0xC7,0x85,0x1B,0xFF,0x73,0x16,0x32,0x5B,0x16,0x32,0xFB,0x34,0xE0,0xFF,0xC6,0x3,0xC1,0x9,0xDA,0x3D,0xD4,0x90,0x34,0xF5,0xFF,0xC4,0x6E,0x80,0xC8,0x5C,0xFB,0x34,0xF6,0xFF,0xC6,0x7,0xC1,0x5,0xDA,0x3D,0xD4,0x90,0x35,0x9,0xFF,0xC4,0x6C,0x81,0x2C,0x7F,0xFB,0x35,0xA,0xFF,0xC6,0x3,0xC1,0x6,0xDA,0x3D,0xD4,0x90,0x35,0x1D,0xFF,0xC4,0x63,0x81,0x2C,0x7F,0xFB,0x35,0x1E,0xFF,0xC6,0x5,0xC1,0x5,0x90,0x35,0x2E,0xFF,0x78,0x4,0x3E,0x60,0x3,0x3E,0xFB,0x35,0x2E,0xFF,0xC6,0x9,0xC1,0x3,0x90,0x35,0x40,0xFF,0xC7,0x81,0x18,0xFF,0x78,0x10,0x37,0xFB,0x35,0x40,0xFF,0xC6,0x3,0xC1,0x5,0x90,0x35,0x5C,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x3,0xC1,0x8,0xFF,0x70,0x6,0x64,0xC4,0x6C,0x81,0x2C,0x7F,0xFB,0x35,0x60,0xFF,0xC6,0x3,0xC1,0x6,0xDA,0x3D,0xD4,0x90,0x35,0x73,0xFF,0xC4,0x63,0x81,0x2C,0x64,0xFB,0x35,0x1E,0xFF,0x90,0x35,0xA2,0x91,0x35,0xB2,0xDC,0x0,0xC6,0x5,0xC1,0x6,0xD9,0x3,0xCC,0x1,0xFC,0xC,0x26,0xC6,0x6,0xC1,0x9,0xD9,0x3,0xCC,0xC7,0xFC,0xC,0x26,0xCC,0x64,0xFC,0xC,0x26,0xFB,0x35,0x84,0xC4,0xC7,0x85,0x26,0xFF,0x69,0x81,0x2C,0x7F,0x66,0x81,0x2C,0x7F,0xFB,0x35,0xA7,0xC0,0x1,0xCA,0x1E,0x78,0xC,0xA,0xC0,0x6C,0xCA,0x5A,0x77,0x1E,0x23,0xC0,0x3B,0xCA,0x37,0x78,0x2E,0x44,0xC0,0x2D,0x7A,0x25,0x22,0xC0,0x2B,0xCA,0x5B,0x75,0x6,0x37,0x77,0x18,0x46,0xC0,0x2B,0xCA,0x15,0x78,0x28,0x34,0xC0,0x1B,0x79,0x18,0x41,0xC0,0x38,0xCA,0x4B,0x75,0x22,0x43,0xC0,0x4C,0xCA,0x69,0x75,0x3,0x36,0x77,0x17,0x3D,0xC0,0x43,0xCA,0x40,0x74,0x28,0x2D,0xC0,0x38,0xFB,0x35,0xB2,0xC6,0x5,0xC1,0x5,0xDA,0x3D,0xB4,0x90,0x36,0xA,0xFF,0xC7,0x81,0x38,0xFF,0x6C,0x3,0x55,0x54,0x2,0x55,0xFB,0x36,0xA,0xFF,0x36,0x98,0x36,0xC0,0x36,0xEE,0x36,0xEE,0x37,0x2C,0x37,0x3D,0x37,0x6E,0x37,0x51,0x37,0x8B,0x37,0xA7,0x37,0xE0,0x37,0xF9,0x38,0x13,0x38,0x3B,0x38,0x77,0x38,0x86,0x38,0xA3,0x38,0xAF,0x38,0xCB,0x38,0xED,0x39,0x0,0x39,0x49,0x39,0x7E,0x39,0xD3,0x3A,0x50,0x1B,0xA2,0x3A,0x60,0x3A,0x6C,0x3A,0x87,0x3A,0xA1,0x1E,0x37,0x3B,0x9A,0x3B,0xB1,0x3B,0xC6,0x3B,0xDB,0x3B,0xF0,0x3C,0x4,0x39,0x49,0x39,0x7E,0x39,0xD3,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x3C,0x7A,0x37,0x8B,0x37,0xA7,0x37,0xE0,0x37,0xF9,0x38,0x13,0x38,0x3B,0x38,0x77,0x38,0x86,0xC6,0x9,0xC1,0x1,0xCA,0x0,0x6E,0xDC,0x0,0xDA,0x3E,0xFC,0x90,0x36,0xAB,0x91,0x36,0xB8,0xFF,0xC7,0x1,0x23,0xA,0x69,0xA,0x50,0xCA,0x0,0x69,0xA,0x50,0xFF,0xCA,0x7F,0xC0,0xC,0x69,0xA,0x50,0xFF,0xC6,0x9,0xC1,0x1,0xCA,0x0,0x6E,0xDC,0x0,0x90,0x36,0xD0,0x91,0x36,0xE7,0xFF,0xCA,0x22,0x2D,0xC,0x50,0x3F,0x29,0xC,0x50,0x3F,0x30,0xC,0x50,0x3F,0x29,0xC,0x26,0x3F,0x30,0xC,0x26,0x3F,0xFF,0xCA,0x5E,0xC0,0x2,0xFB,0x36,0xD2,0xC6,0x9,0xC1,0x1,0xCA,0x0,0x6E,0xDC,0x0,0x90,0x36,0xFE,0x91,0x37,0xB,0xFF,0x6B,0x9,0x5F,0x67,0x9,0x5A,0x6B,0x9,0x5F,0x67,0x9,0x5A,0xFF,0xC0,0x8,0xCA,0x28,0x6B,0x9,0x23,0xCA,0x58,0x67,0x9,0x23,0xCA,0x24,0x6B,0x9,0x1E,0xCA,0x5C,0x67,0x9,0x1E,0xCA,0x1C,0x6B,0x9,0x19,0xCA,0x64,0x67,0x9,0x19,0xFF,0xC6,0x9,0x6E,0xC1,0x2,0x90,0x37,0x35,0xFF,0xC7,0x1,0x20,0x7F,0x78,0x1E,0x66,0xFF,0x6E,0xC6,0x9,0xC1,0x0,0xDA,0x3F,0x28,0x90,0x37,0x49,0xFF,0xC7,0x1,0x20,0x7F,0x75,0x1E,0x4E,0xFF,0xCA,0x0,0x6E,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0xC,0x90,0x37,0x5F,0xFF,0xC7,0x1,0x20,0x8,0x5B,0x8,0x7F,0xC7,0x81,0x27,0xFF,0x54,0x28,0x7F,0xFF,0xCA,0x0,0x6E,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0x90,0x37,0x7C,0xFF,0xC7,0x1,0x1B,0x8,0x60,0x8,0x5D,0xC7,0x81,0x14,0xFF,0x67,0x28,0x5D,0xFF,0xC6,0x9,0x6E,0xC1,0x1,0xDA,0x3F,0x34,0xD7,0x1,0xD8,0x64,0x90,0x37,0x9B,0xFF,0xC4,0xC7,0x85,0x1B,0xFF,0x4F,0x6,0x7F,0x62,0xC,0x7F,0xFF,0xC6,0x9,0x6E,0xC1,0x1,0xDA,0x3F,0x44,0xD7,0x19,0xD8,0x50,0x90,0x37,0xD5,0x91,0x37,0xD1,0xCC,0x5,0xFC,0xC,0x26,0xD7,0x23,0xD8,0x73,0xCC,0x37,0xFC,0xC,0x26,0xD8,0x50,0xCC,0x43,0xFC,0xC,0x26,0xD8,0x0,0xFF,0xC2,0xC,0xC0,0x3,0xC7,0x85,0x18,0xFF,0x5C,0x5,0x6E,0x5C,0x78,0x6E,0xFF,0xC6,0x9,0x6E,0xC1,0x3,0x90,0x37,0xEE,0x91,0x37,0xEC,0xFF,0xC0,0x2,0xC7,0x85,0x2F,0xFF,0x63,0x8,0x5A,0x6F,0x10,0x5A,0xFF,0xC6,0x9,0x6E,0xC1,0x3,0x90,0x38,0x7,0x91,0x38,0x5,0xFF,0xC0,0x2,0xC7,0x85,0x23,0xFF,0x6F,0x8,0x5A,0x63,0x10,0x5A,0xC8,0xFF,0xC6,0x9,0x6E,0xDC,0x0,0xC1,0x3,0xDA,0x3F,0x44,0x90,0x38,0x21,0xFF,0x6D,0x6,0x64,0x79,0x6,0x64,0x79,0xC,0x64,0xCA,0xA,0x79,0x6,0x39,0x79,0xC,0x39,0xCA,0x75,0x79,0x6,0x26,0x79,0xC,0x26,0xFF,0xC6,0x9,0x6E,0xDC,0x0,0xC1,0x3,0xDA,0x3F,0x44,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x38,0x4E,0xFF,0xCA,0x1E,0x6C,0x5,0x69,0xCA,0x32,0x6F,0x5,0x69,0xCA,0x4D,0x74,0x5,0x69,0xCA,0x61,0x78,0xA,0x69,0xCA,0x1E,0x74,0x5,0x2D,0xCA,0x61,0x78,0xA,0x2D,0xCA,0x1E,0x74,0x5,0x20,0xCA,0x61,0x78,0xA,0x20,0xFF,0xCA,0x0,0x6E,0xC6,0x9,0xC1,0x4,0x90,0x38,0x82,0xFF,0x67,0x18,0x69,0xFF,0xCA,0x0,0x6E,0xC6,0x9,0xC1,0x3,0xDA,0x3F,0x18,0x90,0x38,0x94,0xFF,0xC7,0x81,0x17,0xFF,0x63,0x9,0x60,0xC7,0x81,0x24,0xFF,0x6B,0x44,0x64,0xFF,0x6E,0xC6,0x9,0xC1,0x3,0x90,0x38,0xAC,0xFF,0xC0,0x1,0xFF,0xCA,0x0,0x6E,0xC6,0x6,0xC1,0xB,0x90,0x38,0xBA,0xFF,0xC7,0x81,0x20,0xFF,0x27,0x5,0x73,0xFF,0xC7,0x81,0x2C,0xFF,0x33,0x3,0x73,0xFF,0xFF,0xCA,0x0,0xC6,0x9,0xC1,0x1,0xCC,0x3C,0xFC,0xC,0x3F,0x90,0x38,0xDA,0xFF,0x6E,0x3,0x5A,0x6E,0x3,0x1E,0x7A,0x3,0x5A,0x7A,0x3,0x1E,0x6E,0x3,0x5A,0x6E,0x3,0x1E,0xFF,0xC6,0x9,0xC1,0x0,0xDA,0x3D,0xB4,0x90,0x38,0xF8,0xFF,0xC7,0x81,0xF,0xFF,0x73,0x5,0x49,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3E,0x48,0xD8,0x3,0xD7,0x3C,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x39,0x23,0x91,0x39,0x38,0x92,0x39,0x2F,0xCC,0x46,0xFC,0xC,0x26,0xC6,0xA,0xC1,0x8,0xFF,0xFC,0x1C,0xDF,0xC0,0x12,0xC2,0x0,0x67,0x80,0xC8,0x78,0xFF,0xC0,0x6E,0xC2,0x0,0x67,0x80,0xC8,0x1F,0xFF,0xC2,0x18,0xC0,0x1E,0x59,0x2,0x12,0x65,0x7,0x24,0x5E,0x5,0x12,0x6A,0x37,0x24,0xFF,0xC6,0x9,0x6E,0xDC,0x0,0xC1,0x3,0xDA,0x3F,0x44,0xCC,0x19,0xFC,0xC,0x3F,0xDC,0x0,0xD0,0x1,0x90,0x39,0x60,0xFF,0x6E,0x5,0x69,0x75,0x5,0x69,0x7A,0x5,0x69,0xCA,0x1E,0x75,0x5,0x32,0xCA,0x62,0x7A,0x5,0x32,0xCA,0x14,0x75,0x5,0x14,0xCA,0x6C,0x7A,0x5,0x14,0xFF,0xF2,0x4,0xC6,0x9,0xC1,0x2,0xDC,0x0,0xD0,0x1,0xCC,0x1E,0xFC,0xC,0x3F,0xDA,0x3E,0xAC,0xD9,0xDC,0x90,0x39,0x9E,0x91,0x39,0x99,0xFF,0xC2,0xF4,0xFB,0x39,0xA0,0xC2,0xE8,0xFC,0x39,0xA6,0xFC,0x39,0xA6,0xC7,0x85,0x3C,0xC0,0xCA,0x75,0x7C,0x3,0x7E,0xCA,0x69,0x7A,0x3,0x7E,0xCA,0x5D,0x77,0x3,0x7E,0xCA,0x51,0x73,0x3,0x7E,0xCA,0x2E,0x72,0x3,0x7E,0xCA,0x22,0x6E,0x3,0x7E,0xCA,0x16,0x6C,0x3,0x7E,0xCA,0xA,0x69,0x3,0x7E,0xFF,0xF2,0x4,0xC6,0x9,0xC1,0x2,0xCC,0x1E,0xFC,0xC,0x3F,0xDA,0x3F,0x54,0xD9,0xDC,0x90,0x39,0xEF,0x91,0x39,0xEA,0xFF,0xC2,0x18,0xFB,0x39,0xF1,0xC2,0xC,0xC7,0x85,0xF,0x80,0x4F,0x3,0x7E,0x53,0x3,0x7E,0x56,0x3,0x7E,0x5B,0x3,0x7E,0x56,0x3,0x7E,0x5B,0x3,0x7E,0x5F,0x3,0x7E,0x62,0x3,0x7E,0x67,0x3,0x7E,0x62,0x3,0x7E,0x57,0x3,0x7E,0x5B,0x3,0x7E,0x5E,0x3,0x7E,0x63,0x3,0x7E,0x5E,0x3,0x7E,0x63,0x3,0x7E,0x67,0x3,0x7E,0x6A,0x3,0x7E,0x6F,0x3,0x7E,0x6A,0x3,0x7E,0x59,0x3,0x7E,0x5D,0x3,0x7E,0x60,0x3,0x7E,0x65,0x3,0x7E,0x60,0x3,0x7E,0x65,0x3,0x7E,0x69,0x3,0x7E,0x6C,0x3,0x7E,0x71,0x3,0x7E,0x6C,0x3,0x7E,0xFF,0xC6,0x6,0xC1,0x9,0xCC,0x19,0xFC,0xC,0x3F,0x90,0x32,0x18,0x91,0x32,0x18,0xFF,0xC6,0x9,0xC1,0x5,0x90,0x3A,0x68,0xFF,0x67,0x30,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0xDA,0x3D,0xC4,0x90,0x3A,0x77,0xFF,0xC2,0xF4,0xC7,0x83,0x3,0xFF,0x4F,0xA,0x7F,0xC4,0xC2,0x0,0x6E,0x64,0x7F,0xFF,0xC6,0x9,0xC1,0x3,0x90,0x3A,0x92,0xDA,0x3D,0xC4,0xFF,0xC7,0x81,0x3,0xFF,0x4F,0xC,0x7F,0xC7,0x81,0x27,0xFF,0x43,0x64,0x7F,0xFF,0xC6,0x9,0x6E,0xDC,0x0,0xC1,0x3,0xDA,0x3E,0xFC,0xD4,0x1E,0x90,0x3B,0x2D,0x91,0x3A,0xB4,0xFF,0xC2,0xE8,0xCA,0x18,0xFC,0x3B,0x8,0xC2,0xF4,0xCA,0x2C,0xFC,0x3B,0x8,0xC2,0x0,0xCA,0x40,0xFC,0x3B,0x8,0xC2,0xC,0xCA,0x54,0xFC,0x3B,0x8,0xC2,0x18,0xCA,0x68,0xFC,0x3B,0x8,0xCA,0x18,0x78,0x2,0x64,0x78,0x1,0x32,0xCA,0x68,0x7C,0x14,0x46,0x7C,0xA,0x1E,0xCA,0x18,0x78,0x2,0x32,0x78,0x1,0x14,0xCA,0x68,0x7C,0x14,0x1E,0x7C,0xA,0xA,0xCA,0x18,0x78,0x2,0x1E,0x78,0x1,0xA,0xCA,0x68,0x7C,0x14,0x14,0x7C,0xA,0x7,0xFF,0x73,0x2,0x32,0x67,0x1,0x28,0x67,0x2,0x14,0x77,0x2,0x32,0x6B,0x1,0x28,0x6B,0x2,0x14,0x78,0x2,0x32,0x6C,0x1,0x28,0x6C,0x2,0x14,0x7C,0x2,0x32,0x70,0x1,0x28,0x70,0x2,0x14,0xFF,0xC2,0xE8,0xFC,0x3B,0x6D,0xC2,0xF4,0xFC,0x3B,0x6D,0xC2,0x0,0xFC,0x3B,0x6D,0xC2,0xC,0xFC,0x3B,0x6D,0xC2,0x18,0xFC,0x3B,0x6D,0xCA,0x40,0x6C,0x1,0x64,0x78,0x2,0x32,0x70,0xA,0x46,0x7C,0x14,0x1E,0x6C,0x1,0x32,0x78,0x2,0x14,0x70,0xA,0x1E,0x7C,0x14,0xA,0x6C,0x1,0x1E,0x78,0x2,0xA,0x70,0xA,0x14,0x7C,0x14,0x7,0xFF,0xCA,0x36,0x67,0x3,0x64,0x73,0x1,0x32,0x73,0x1,0x14,0xCA,0x4A,0x6B,0x3,0x64,0x77,0x1,0x32,0x77,0x1,0x14,0xCA,0x36,0x6C,0x3,0x64,0x78,0x1,0x32,0x78,0x1,0x14,0xCA,0x4A,0x70,0x3,0x64,0x7C,0x1,0x32,0x7C,0x1,0x14,0xFF,0xC6,0xA,0xC1,0xE,0x90,0x3B,0xA5,0x91,0x3B,0xAA,0xFF,0x67,0x80,0xFA,0x7F,0xFF,0xC0,0x9,0x67,0x80,0xF1,0x2D,0xFF,0xC6,0x9,0xC1,0x1,0x90,0x3B,0xB9,0xFF,0x6E,0x3,0x5A,0x6E,0x3,0x1E,0x7A,0x3,0x5A,0x7A,0x3,0x1E,0xFF,0xC6,0x9,0xC1,0x1,0x90,0x3B,0xCE,0xFF,0x7A,0x3,0x5A,0x7A,0x3,0x1E,0x6E,0x3,0x5A,0x6E,0x3,0x1E,0xFF,0xF2,0x6,0xC6,0x9,0x6E,0xDC,0x0,0xC1,0x3,0xDA,0x3E,0xFC,0xD4,0x1E,0x90,0x3B,0x3C,0x91,0x3A,0xC4,0xFF,0xC6,0x4,0xC1,0xE,0x90,0x1E,0x3F,0xCC,0x1,0xFC,0xC,0x26,0xC6,0xA,0xC1,0xC,0x91,0x19,0x35,0xFF,0xC6,0x8,0xC1,0x1A,0x90,0x3C,0xC,0xFF,0x67,0x80,0xB4,0x7F,0xFF,0xC1,0x80,0x6E,0xDC,0x0,0xDA,0x3E,0x68,0x84,0xC8,0x28,0xCB,0x3C,0x2D,0xC7,0x0,0x3C,0x78,0x90,0x3C,0x35,0x91,0x3C,0x57,0x92,0x3C,0x37,0xFF,0x0,0x2,0x4,0x5,0x7,0x9,0xB,0xC,0xC0,0x6,0xFC,0x3C,0x77,0x2E,0xC,0x4B,0x14,0x2D,0xC,0x4B,0x14,0x2E,0xC,0x4B,0x14,0x3A,0x10,0x50,0x50,0x3A,0x10,0x2D,0x50,0x3A,0x10,0x14,0x50,0x3A,0x10,0xF,0x50,0xFF,0xFC,0x3C,0x77,0x29,0xC,0x4B,0x14,0x28,0xC,0x4B,0x14,0x29,0xC,0x4B,0x14,0x35,0x10,0x50,0x50,0x35,0x10,0x2D,0x50,0x35,0x10,0x14,0x50,0x35,0x10,0xF,0x50,0xFF,0xC2,0x0,0xFF,0xC6,0x4,0xC1,0xE,0x6E,0xDC,0x0,0x84,0xC8,0x30,0xCB,0x3C,0x2D,0xC7,0x0,0x3C,0x90,0x90,0x3C,0x8F,0xFF,0xC2,0x0,0x60,0x7F,0x73,0xFF,0xC6,0x5,0xC1,0x9,0xCC,0x28,0xFC,0xC,0x3F,0x90,0x3C,0xA2,0xFF,0xC0,0x4B,0x27,0x80,0xF5,0x64,0x7F,0x27,0xA,0x55,0x7F,0x28,0x81,0x23,0x62,0x7F,0x27,0x80,0x91,0x4B,0x7F,0x29,0x80,0xBD,0x54,0x7F,0x27,0x4B,0x49,0x7F,0x27,0x80,0x96,0x5E,0x7F,0x24,0x74,0x4E,0x7F,0xFB,0x3C,0xA2,0xFF,0xC6,0x5,0xC1,0xA,0xCC,0x3C,0xFC,0xC,0x3F,0x90,0x3C,0xDA,0xFF,0xC0,0x14,0x67,0x71,0x46,0x65,0x80,0xD3,0x3E,0x67,0x48,0x54,0x68,0x71,0x31,0x67,0x80,0xA8,0x41,0x69,0x80,0x86,0x3B,0x69,0x31,0x36,0x66,0x6F,0x33,0x67,0x80,0xC7,0x4F,0x63,0x80,0xE9,0x4A,0xFB,0x3C,0xDA,0xFF,0xC6,0x5,0xC1,0xC,0xCC,0x1E,0xFC,0xC,0x3F,0x90,0x3D,0x10,0xFF,0xC0,0x32,0x69,0x31,0x42,0xC0,0x80,0x9F,0x67,0x31,0x33,0xC0,0x80,0xF9,0x66,0x1D,0x3C,0x69,0x4C,0x4D,0xC0,0x80,0x64,0x6A,0x31,0x3B,0xC0,0x81,0x59,0x64,0x4F,0x3D,0xC0,0x80,0xC6,0xFB,0x3D,0x10,0xFF,0xC6,0x5,0xCC,0xF,0xFC,0xC,0x3F,0x90,0x3D,0x48,0x91,0x3D,0x6E,0x92,0x3D,0x70,0xFF,0xC6,0x8,0xC0,0x18,0x69,0x9,0x1A,0x65,0x80,0xBC,0x16,0x67,0x71,0x21,0x68,0x80,0xD7,0x21,0x67,0x54,0x27,0x67,0x6F,0x1F,0x6B,0x80,0xA8,0x1A,0x68,0x80,0xE1,0x16,0x66,0x74,0x1F,0xFB,0x3D,0x48,0xC2,0xC,0xC6,0xD,0xC4,0xC0,0xF,0x67,0x81,0x2C,0x19,0xFB,0x3D,0x75,0xCC,0x12,0xFB,0x3D,0x83,0xCC,0x2A,0xC7,0x0,0x3D,0xAF,0xF2,0x4,0xC6,0x4,0xC1,0x2,0xDA,0x3E,0x4,0xD9,0xF,0x90,0x3D,0xA6,0x91,0x3D,0xA2,0xFE,0x80,0x70,0xC8,0xFF,0xFA,0x3D,0x98,0xF1,0xFF,0xC6,0x9,0xC2,0xC,0x32,0x3,0x7F,0x7F,0x26,0x3,0x7F,0x7F,0xC0,0x2A,0xFB,0x3D,0xA6,0x0,0x0,0x7,0x4E,0x20,0x0,0x6,0x7F,0xBC,0x7F,0xBC,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0x9,0x3A,0x98,0x0,0x7,0x7F,0xBC,0x7F,0xBC,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0xA,0x27,0x10,0x0,0x64,0x7F,0xBC,0x7F,0xBC,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0x23,0x7F,0xBC,0x0,0xA,0x7F,0xBC,0x1,0x2C,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0xF,0x4E,0x20,0x0,0x5,0x7F,0xBC,0x7F,0xBC,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0x8,0x7F,0xBC,0x0,0x32,0x7F,0xBC,0x1,0x2C,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x64,0x61,0xA8,0x0,0x23,0x7F,0xBC,0x1,0x2C,0x13,0x88,0xFF,0xFE,0x0,0x2,0x0,0x19,0x7F,0xBC,0x0,0x4,0x57,0xE4,0x0,0x23,0x7F,0xBC,0xFF,0xFE,0x0,0x2,0x0,0x1,0x7F,0xBC,0x0,0xA,0x75,0x30,0x0,0x32,0x75,0x30,0x0,0x64,0x0,0x0,0xFF,0xFE,0x0,0x3,0x0,0x4,0x7F,0xBC,0x0,0x64,0x3A,0x98,0x3,0xE8,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0xA,0x7F,0xBC,0x0,0x1,0x7F,0xBC,0x0,0xA,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x3,0x7F,0xBC,0x0,0xA,0x75,0x30,0x0,0xA,0x27,0x10,0x0,0x64,0x0,0x0,0xFF,0xFE,0x0,0x3,0x0,0x1,0x7F,0xBC,0x0,0x14,0x7F,0xBC,0x2,0x58,0x17,0x70,0xFF,0xFE,0x0,0x2,0x0,0x1,0x7F,0xBC,0x0,0x14,0x7F,0xBC,0x0,0x64,0x46,0x50,0xFF,0xFE,0x0,0x2,0x0,0x1,0x7F,0xBC,0x0,0x14,0x7F,0xBC,0x1,0x2C,0x17,0x70,0xFF,0xFE,0x0,0x2,0x0,0x7,0x46,0x50,0x0,0x4,0x7F,0xF8,0x0,0x1E,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x13,0x7F,0xBC,0x0,0x5,0x7F,0xBC,0x0,0xF,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x19,0x7F,0xBC,0x0,0x9,0x7F,0xBC,0x0,0x9,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x1,0x7F,0xBC,0x0,0x64,0x7F,0xF8,0x1,0x2C,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x16,0x7F,0xBC,0x0,0x32,0x7F,0xF8,0x0,0x46,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x5,0x7F,0xF8,0x0,0xC0,0x0,0x0,0x3,0xE8,0x3,0xE8,0xFF,0xFE,0x0,0x2,0x0,0x19,0x7F,0xF8,0x0,0x3C,0x27,0x10,0xFF,0xFE,0x0,0x2,0x0,0x1,0x27,0x10,0x0,0x1,0x27,0x10,0x0,0x28,0x7F,0xF8,0xFF,0xFE,0x0,0x2,0x0,0x17,0x7F,0xF8,0x0,0x50,0x3A,0x98,0xFF,0xFE,0x0,0x2,0x0,0x16,0x7F,0xF8,0x0,0x32,0x7F,0xF8,0x0,0x64,0x61,0xA8,0xFF,0xFE,0x0,0x2,0x0,0xD,0x7F,0xF8,0x0,0x32,0x7F,0xF8,0x0,0xC8,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x6,0x2E,0xE0,0x0,0x4,0x7F,0xF8,0x0,0x32,0x7F,0xF8,0x0,0xC8,0x0,0x0,0xFF,0xFE,0x0,0x2,0x0,0x1,0x7F,0xBC,0x3,0xE8,0x7F,0xBC,0x0,0xA,0x3E,0x80,0x0,0xC8,0x7F,0xF8,0xFF,0xFE,0x0,0x3,0x0,0x0,0x0,0x0,
@@ -0,0 +1,1359 @@
+static u8 dialog_text_DIALOG_000[373] = { 0xFF };
+static u8 dialog_text_DIALOG_001[401] = { 0xFF };
+static u8 dialog_text_DIALOG_002[287] = { 0xFF };
+static u8 dialog_text_DIALOG_003[307] = { 0xFF };
+static u8 dialog_text_DIALOG_004[184] = { 0xFF };
+static u8 dialog_text_DIALOG_005[331] = { 0xFF };
+static u8 dialog_text_DIALOG_006[110] = { 0xFF };
+static u8 dialog_text_DIALOG_007[112] = { 0xFF };
+static u8 dialog_text_DIALOG_008[209] = { 0xFF };
+static u8 dialog_text_DIALOG_009[257] = { 0xFF };
+static u8 dialog_text_DIALOG_010[174] = { 0xFF };
+static u8 dialog_text_DIALOG_011[178] = { 0xFF };
+static u8 dialog_text_DIALOG_012[177] = { 0xFF };
+static u8 dialog_text_DIALOG_013[97] = { 0xFF };
+static u8 dialog_text_DIALOG_014[113] = { 0xFF };
+static u8 dialog_text_DIALOG_015[175] = { 0xFF };
+static u8 dialog_text_DIALOG_016[74] = { 0xFF };
+static u8 dialog_text_DIALOG_017[444] = { 0xFF };
+static u8 dialog_text_DIALOG_018[90] = { 0xFF };
+static u8 dialog_text_DIALOG_019[40] = { 0xFF };
+static u8 dialog_text_DIALOG_020[95] = { 0xFF };
+static u8 dialog_text_DIALOG_021[68] = { 0xFF };
+static u8 dialog_text_DIALOG_022[34] = { 0xFF };
+static u8 dialog_text_DIALOG_023[51] = { 0xFF };
+static u8 dialog_text_DIALOG_024[110] = { 0xFF };
+static u8 dialog_text_DIALOG_025[70] = { 0xFF };
+static u8 dialog_text_DIALOG_026[70] = { 0xFF };
+static u8 dialog_text_DIALOG_027[71] = { 0xFF };
+static u8 dialog_text_DIALOG_028[71] = { 0xFF };
+static u8 dialog_text_DIALOG_029[77] = { 0xFF };
+static u8 dialog_text_DIALOG_030[448] = { 0xFF };
+static u8 dialog_text_DIALOG_031[188] = { 0xFF };
+static u8 dialog_text_DIALOG_032[245] = { 0xFF };
+static u8 dialog_text_DIALOG_033[260] = { 0xFF };
+static u8 dialog_text_DIALOG_034[613] = { 0xFF };
+static u8 dialog_text_DIALOG_035[413] = { 0xFF };
+static u8 dialog_text_DIALOG_036[271] = { 0xFF };
+static u8 dialog_text_DIALOG_037[97] = { 0xFF };
+static u8 dialog_text_DIALOG_038[47] = { 0xFF };
+static u8 dialog_text_DIALOG_039[373] = { 0xFF };
+static u8 dialog_text_DIALOG_040[36] = { 0xFF };
+static u8 dialog_text_DIALOG_041[101] = { 0xFF };
+static u8 dialog_text_DIALOG_042[307] = { 0xFF };
+static u8 dialog_text_DIALOG_043[110] = { 0xFF };
+static u8 dialog_text_DIALOG_044[284] = { 0xFF };
+static u8 dialog_text_DIALOG_045[130] = { 0xFF };
+static u8 dialog_text_DIALOG_046[472] = { 0xFF };
+static u8 dialog_text_DIALOG_047[33] = { 0xFF };
+static u8 dialog_text_DIALOG_048[82] = { 0xFF };
+static u8 dialog_text_DIALOG_049[235] = { 0xFF };
+static u8 dialog_text_DIALOG_050[243] = { 0xFF };
+static u8 dialog_text_DIALOG_051[287] = { 0xFF };
+static u8 dialog_text_DIALOG_052[181] = { 0xFF };
+static u8 dialog_text_DIALOG_053[162] = { 0xFF };
+static u8 dialog_text_DIALOG_054[105] = { 0xFF };
+static u8 dialog_text_DIALOG_055[230] = { 0xFF };
+static u8 dialog_text_DIALOG_056[193] = { 0xFF };
+static u8 dialog_text_DIALOG_057[240] = { 0xFF };
+static u8 dialog_text_DIALOG_058[160] = { 0xFF };
+static u8 dialog_text_DIALOG_059[81] = { 0xFF };
+static u8 dialog_text_DIALOG_060[468] = { 0xFF };
+static u8 dialog_text_DIALOG_061[70] = { 0xFF };
+static u8 dialog_text_DIALOG_062[200] = { 0xFF };
+static u8 dialog_text_DIALOG_063[178] = { 0xFF };
+static u8 dialog_text_DIALOG_064[205] = { 0xFF };
+static u8 dialog_text_DIALOG_065[480] = { 0xFF };
+static u8 dialog_text_DIALOG_066[507] = { 0xFF };
+static u8 dialog_text_DIALOG_067[198] = { 0xFF };
+static u8 dialog_text_DIALOG_068[167] = { 0xFF };
+static u8 dialog_text_DIALOG_069[122] = { 0xFF };
+static u8 dialog_text_DIALOG_070[535] = { 0xFF };
+static u8 dialog_text_DIALOG_071[146] = { 0xFF };
+static u8 dialog_text_DIALOG_072[98] = { 0xFF };
+static u8 dialog_text_DIALOG_073[192] = { 0xFF };
+static u8 dialog_text_DIALOG_074[304] = { 0xFF };
+static u8 dialog_text_DIALOG_075[528] = { 0xFF };
+static u8 dialog_text_DIALOG_076[363] = { 0xFF };
+static u8 dialog_text_DIALOG_077[46] = { 0xFF };
+static u8 dialog_text_DIALOG_078[197] = { 0xFF };
+static u8 dialog_text_DIALOG_079[192] = { 0xFF };
+static u8 dialog_text_DIALOG_080[18] = { 0xFF };
+static u8 dialog_text_DIALOG_081[123] = { 0xFF };
+static u8 dialog_text_DIALOG_082[400] = { 0xFF };
+static u8 dialog_text_DIALOG_083[137] = { 0xFF };
+static u8 dialog_text_DIALOG_084[249] = { 0xFF };
+static u8 dialog_text_DIALOG_085[107] = { 0xFF };
+static u8 dialog_text_DIALOG_086[61] = { 0xFF };
+static u8 dialog_text_DIALOG_087[88] = { 0xFF };
+static u8 dialog_text_DIALOG_088[90] = { 0xFF };
+static u8 dialog_text_DIALOG_089[252] = { 0xFF };
+static u8 dialog_text_DIALOG_090[108] = { 0xFF };
+static u8 dialog_text_DIALOG_091[53] = { 0xFF };
+static u8 dialog_text_DIALOG_092[182] = { 0xFF };
+static u8 dialog_text_DIALOG_093[238] = { 0xFF };
+static u8 dialog_text_DIALOG_094[77] = { 0xFF };
+static u8 dialog_text_DIALOG_095[219] = { 0xFF };
+static u8 dialog_text_DIALOG_096[176] = { 0xFF };
+static u8 dialog_text_DIALOG_097[117] = { 0xFF };
+static u8 dialog_text_DIALOG_098[39] = { 0xFF };
+static u8 dialog_text_DIALOG_099[104] = { 0xFF };
+static u8 dialog_text_DIALOG_100[70] = { 0xFF };
+static u8 dialog_text_DIALOG_101[217] = { 0xFF };
+static u8 dialog_text_DIALOG_102[197] = { 0xFF };
+static u8 dialog_text_DIALOG_103[74] = { 0xFF };
+static u8 dialog_text_DIALOG_104[108] = { 0xFF };
+static u8 dialog_text_DIALOG_105[221] = { 0xFF };
+static u8 dialog_text_DIALOG_106[48] = { 0xFF };
+static u8 dialog_text_DIALOG_107[80] = { 0xFF };
+static u8 dialog_text_DIALOG_108[89] = { 0xFF };
+static u8 dialog_text_DIALOG_109[184] = { 0xFF };
+static u8 dialog_text_DIALOG_110[112] = { 0xFF };
+static u8 dialog_text_DIALOG_111[87] = { 0xFF };
+static u8 dialog_text_DIALOG_112[267] = { 0xFF };
+static u8 dialog_text_DIALOG_113[121] = { 0xFF };
+static u8 dialog_text_DIALOG_114[269] = { 0xFF };
+static u8 dialog_text_DIALOG_115[116] = { 0xFF };
+static u8 dialog_text_DIALOG_116[358] = { 0xFF };
+static u8 dialog_text_DIALOG_117[163] = { 0xFF };
+static u8 dialog_text_DIALOG_118[157] = { 0xFF };
+static u8 dialog_text_DIALOG_119[251] = { 0xFF };
+static u8 dialog_text_DIALOG_120[251] = { 0xFF };
+static u8 dialog_text_DIALOG_121[255] = { 0xFF };
+static u8 dialog_text_DIALOG_122[75] = { 0xFF };
+static u8 dialog_text_DIALOG_123[56] = { 0xFF };
+static u8 dialog_text_DIALOG_124[109] = { 0xFF };
+static u8 dialog_text_DIALOG_125[46] = { 0xFF };
+static u8 dialog_text_DIALOG_126[50] = { 0xFF };
+static u8 dialog_text_DIALOG_127[170] = { 0xFF };
+static u8 dialog_text_DIALOG_128[86] = { 0xFF };
+static u8 dialog_text_DIALOG_129[234] = { 0xFF };
+static u8 dialog_text_DIALOG_130[181] = { 0xFF };
+static u8 dialog_text_DIALOG_131[357] = { 0xFF };
+static u8 dialog_text_DIALOG_132[152] = { 0xFF };
+static u8 dialog_text_DIALOG_133[566] = { 0xFF };
+static u8 dialog_text_DIALOG_134[300] = { 0xFF };
+static u8 dialog_text_DIALOG_135[335] = { 0xFF };
+static u8 dialog_text_DIALOG_136[493] = { 0xFF };
+static u8 dialog_text_DIALOG_137[251] = { 0xFF };
+static u8 dialog_text_DIALOG_138[66] = { 0xFF };
+static u8 dialog_text_DIALOG_139[118] = { 0xFF };
+static u8 dialog_text_DIALOG_140[95] = { 0xFF };
+static u8 dialog_text_DIALOG_141[299] = { 0xFF };
+static u8 dialog_text_DIALOG_142[186] = { 0xFF };
+static u8 dialog_text_DIALOG_143[138] = { 0xFF };
+static u8 dialog_text_DIALOG_144[337] = { 0xFF };
+static u8 dialog_text_DIALOG_145[279] = { 0xFF };
+static u8 dialog_text_DIALOG_146[136] = { 0xFF };
+static u8 dialog_text_DIALOG_147[331] = { 0xFF };
+static u8 dialog_text_DIALOG_148[201] = { 0xFF };
+static u8 dialog_text_DIALOG_149[206] = { 0xFF };
+static u8 dialog_text_DIALOG_150[303] = { 0xFF };
+static u8 dialog_text_DIALOG_151[127] = { 0xFF };
+static u8 dialog_text_DIALOG_152[235] = { 0xFF };
+static u8 dialog_text_DIALOG_153[130] = { 0xFF };
+static u8 dialog_text_DIALOG_154[282] = { 0xFF };
+static u8 dialog_text_DIALOG_155[330] = { 0xFF };
+static u8 dialog_text_DIALOG_156[92] = { 0xFF };
+static u8 dialog_text_DIALOG_157[185] = { 0xFF };
+static u8 dialog_text_DIALOG_158[260] = { 0xFF };
+static u8 dialog_text_DIALOG_159[126] = { 0xFF };
+static u8 dialog_text_DIALOG_160[92] = { 0xFF };
+static u8 dialog_text_DIALOG_161[530] = { 0xFF };
+static u8 dialog_text_DIALOG_162[243] = { 0xFF };
+static u8 dialog_text_DIALOG_163[411] = { 0xFF };
+static u8 dialog_text_DIALOG_164[205] = { 0xFF };
+static u8 dialog_text_DIALOG_165[104] = { 0xFF };
+static u8 dialog_text_DIALOG_166[79] = { 0xFF };
+static u8 dialog_text_DIALOG_167[170] = { 0xFF };
+static u8 dialog_text_DIALOG_168[97] = { 0xFF };
+static u8 dialog_text_DIALOG_169[107] = { 0xFF };
+static const struct DialogEntry dialog_entry_orig_DIALOG_000 = { 1, 6, 30, 200, dialog_text_DIALOG_000 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_001 = { 1, 4, 95, 200, dialog_text_DIALOG_001 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_002 = { 1, 4, 95, 200, dialog_text_DIALOG_002 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_003 = { 1, 5, 95, 200, dialog_text_DIALOG_003 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_004 = { 1, 3, 95, 200, dialog_text_DIALOG_004 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_005 = { 1, 3, 30, 200, dialog_text_DIALOG_005 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_006 = { 1, 3, 30, 200, dialog_text_DIALOG_006 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_007 = { 1, 5, 30, 200, dialog_text_DIALOG_007 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_008 = { 1, 4, 30, 200, dialog_text_DIALOG_008 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_009 = { 1, 5, 30, 200, dialog_text_DIALOG_009 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_010 = { 1, 4, 30, 200, dialog_text_DIALOG_010 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_011 = { 1, 4, 30, 200, dialog_text_DIALOG_011 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_012 = { 1, 4, 30, 200, dialog_text_DIALOG_012 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_013 = { 1, 5, 30, 200, dialog_text_DIALOG_013 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_014 = { 1, 4, 30, 200, dialog_text_DIALOG_014 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_015 = { 1, 4, 30, 200, dialog_text_DIALOG_015 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_016 = { 1, 3, 30, 200, dialog_text_DIALOG_016 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_017 = { 1, 4, 30, 200, dialog_text_DIALOG_017 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_018 = { 1, 4, 30, 200, dialog_text_DIALOG_018 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_019 = { 1, 2, 30, 200, dialog_text_DIALOG_019 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_020 = { 1, 6, 95, 150, dialog_text_DIALOG_020 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_021 = { 1, 5, 95, 200, dialog_text_DIALOG_021 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_022 = { 1, 2, 95, 200, dialog_text_DIALOG_022 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_023 = { 1, 3, 95, 200, dialog_text_DIALOG_023 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_024 = { 1, 5, 95, 200, dialog_text_DIALOG_024 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_025 = { 1, 4, 95, 200, dialog_text_DIALOG_025 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_026 = { 1, 4, 95, 200, dialog_text_DIALOG_026 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_027 = { 1, 4, 95, 200, dialog_text_DIALOG_027 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_028 = { 1, 4, 95, 200, dialog_text_DIALOG_028 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_029 = { 1, 5, 95, 200, dialog_text_DIALOG_029 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_030 = { 1, 6, 30, 200, dialog_text_DIALOG_030 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_031 = { 1, 5, 30, 200, dialog_text_DIALOG_031 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_032 = { 1, 5, 30, 200, dialog_text_DIALOG_032 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_033 = { 1, 6, 30, 200, dialog_text_DIALOG_033 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_034 = { 1, 6, 30, 200, dialog_text_DIALOG_034 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_035 = { 1, 5, 30, 200, dialog_text_DIALOG_035 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_036 = { 1, 5, 30, 200, dialog_text_DIALOG_036 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_037 = { 1, 2, 30, 200, dialog_text_DIALOG_037 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_038 = { 1, 3, 95, 200, dialog_text_DIALOG_038 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_039 = { 1, 4, 30, 200, dialog_text_DIALOG_039 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_040 = { 1, 3, 30, 200, dialog_text_DIALOG_040 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_041 = { 1, 3, 30, 200, dialog_text_DIALOG_041 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_042 = { 1, 4, 30, 200, dialog_text_DIALOG_042 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_043 = { 1, 5, 30, 200, dialog_text_DIALOG_043 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_044 = { 1, 5, 95, 200, dialog_text_DIALOG_044 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_045 = { 1, 6, 95, 200, dialog_text_DIALOG_045 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_046 = { 1, 5, 30, 200, dialog_text_DIALOG_046 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_047 = { 1, 2, 95, 200, dialog_text_DIALOG_047 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_048 = { 1, 4, 30, 200, dialog_text_DIALOG_048 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_049 = { 1, 5, 30, 200, dialog_text_DIALOG_049 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_050 = { 1, 4, 30, 200, dialog_text_DIALOG_050 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_051 = { 1, 6, 30, 200, dialog_text_DIALOG_051 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_052 = { 1, 5, 30, 200, dialog_text_DIALOG_052 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_053 = { 1, 5, 30, 200, dialog_text_DIALOG_053 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_054 = { 1, 5, 30, 200, dialog_text_DIALOG_054 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_055 = { 1, 4, 30, 200, dialog_text_DIALOG_055 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_056 = { 1, 6, 30, 200, dialog_text_DIALOG_056 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_057 = { 1, 4, 30, 200, dialog_text_DIALOG_057 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_058 = { 1, 4, 30, 200, dialog_text_DIALOG_058 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_059 = { 1, 4, 30, 200, dialog_text_DIALOG_059 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_060 = { 1, 4, 30, 200, dialog_text_DIALOG_060 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_061 = { 1, 4, 30, 200, dialog_text_DIALOG_061 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_062 = { 1, 3, 30, 200, dialog_text_DIALOG_062 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_063 = { 1, 5, 30, 200, dialog_text_DIALOG_063 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_064 = { 1, 5, 30, 200, dialog_text_DIALOG_064 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_065 = { 1, 6, 30, 200, dialog_text_DIALOG_065 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_066 = { 1, 5, 30, 200, dialog_text_DIALOG_066 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_067 = { 1, 5, 30, 200, dialog_text_DIALOG_067 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_068 = { 1, 5, 30, 200, dialog_text_DIALOG_068 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_069 = { 1, 6, 30, 200, dialog_text_DIALOG_069 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_070 = { 1, 5, 30, 200, dialog_text_DIALOG_070 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_071 = { 1, 3, 30, 200, dialog_text_DIALOG_071 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_072 = { 1, 5, 30, 200, dialog_text_DIALOG_072 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_073 = { 1, 4, 95, 200, dialog_text_DIALOG_073 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_074 = { 1, 5, 30, 200, dialog_text_DIALOG_074 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_075 = { 1, 5, 30, 200, dialog_text_DIALOG_075 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_076 = { 1, 6, 30, 200, dialog_text_DIALOG_076 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_077 = { 1, 2, 150, 200, dialog_text_DIALOG_077 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_078 = { 1, 5, 30, 200, dialog_text_DIALOG_078 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_079 = { 1, 4, 30, 200, dialog_text_DIALOG_079 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_080 = { 1, 1, 30, 200, dialog_text_DIALOG_080 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_081 = { 1, 4, 30, 200, dialog_text_DIALOG_081 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_082 = { 1, 4, 30, 200, dialog_text_DIALOG_082 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_083 = { 1, 6, 30, 200, dialog_text_DIALOG_083 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_084 = { 1, 3, 30, 200, dialog_text_DIALOG_084 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_085 = { 1, 5, 30, 200, dialog_text_DIALOG_085 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_086 = { 1, 3, 30, 200, dialog_text_DIALOG_086 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_087 = { 1, 4, 30, 200, dialog_text_DIALOG_087 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_088 = { 1, 5, 30, 200, dialog_text_DIALOG_088 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_089 = { 1, 5, 95, 200, dialog_text_DIALOG_089 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_090 = { 1, 6, 30, 200, dialog_text_DIALOG_090 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_091 = { 2, 2, 30, 200, dialog_text_DIALOG_091 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_092 = { 1, 5, 30, 200, dialog_text_DIALOG_092 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_093 = { 1, 5, 30, 200, dialog_text_DIALOG_093 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_094 = { 1, 4, 30, 200, dialog_text_DIALOG_094 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_095 = { 1, 4, 30, 200, dialog_text_DIALOG_095 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_096 = { 1, 4, 30, 200, dialog_text_DIALOG_096 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_097 = { 1, 5, 30, 200, dialog_text_DIALOG_097 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_098 = { 1, 2, 95, 200, dialog_text_DIALOG_098 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_099 = { 1, 5, 95, 200, dialog_text_DIALOG_099 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_100 = { 1, 3, 95, 200, dialog_text_DIALOG_100 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_101 = { 1, 3, 95, 200, dialog_text_DIALOG_101 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_102 = { 1, 5, 30, 200, dialog_text_DIALOG_102 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_103 = { 1, 4, 95, 200, dialog_text_DIALOG_103 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_104 = { 1, 5, 30, 200, dialog_text_DIALOG_104 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_105 = { 1, 3, 95, 200, dialog_text_DIALOG_105 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_106 = { 1, 2, 95, 200, dialog_text_DIALOG_106 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_107 = { 1, 3, 95, 200, dialog_text_DIALOG_107 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_108 = { 1, 2, 95, 200, dialog_text_DIALOG_108 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_109 = { 1, 4, 95, 200, dialog_text_DIALOG_109 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_110 = { 1, 5, 95, 200, dialog_text_DIALOG_110 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_111 = { 1, 4, 95, 200, dialog_text_DIALOG_111 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_112 = { 1, 4, 30, 200, dialog_text_DIALOG_112 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_113 = { 1, 6, 30, 200, dialog_text_DIALOG_113 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_114 = { 1, 5, 95, 200, dialog_text_DIALOG_114 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_115 = { 1, 5, 95, 200, dialog_text_DIALOG_115 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_116 = { 1, 5, 95, 200, dialog_text_DIALOG_116 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_117 = { 1, 1, 95, 200, dialog_text_DIALOG_117 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_118 = { 1, 6, 95, 200, dialog_text_DIALOG_118 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_119 = { 1, 6, 30, 200, dialog_text_DIALOG_119 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_120 = { 1, 4, 30, 200, dialog_text_DIALOG_120 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_121 = { 1, 5, 30, 200, dialog_text_DIALOG_121 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_122 = { 1, 4, 30, 200, dialog_text_DIALOG_122 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_123 = { 1, 4, 30, 200, dialog_text_DIALOG_123 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_124 = { 1, 4, 30, 200, dialog_text_DIALOG_124 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_125 = { 1, 3, 30, 200, dialog_text_DIALOG_125 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_126 = { 2, 3, 30, 200, dialog_text_DIALOG_126 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_127 = { 3, 4, 30, 200, dialog_text_DIALOG_127 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_128 = { 1, 4, 95, 200, dialog_text_DIALOG_128 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_129 = { 1, 5, 30, 200, dialog_text_DIALOG_129 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_130 = { 1, 5, 30, 200, dialog_text_DIALOG_130 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_131 = { 1, 5, 30, 200, dialog_text_DIALOG_131 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_132 = { 1, 4, 30, 200, dialog_text_DIALOG_132 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_133 = { 1, 6, 30, 200, dialog_text_DIALOG_133 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_134 = { 1, 5, 30, 200, dialog_text_DIALOG_134 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_135 = { 1, 5, 30, 200, dialog_text_DIALOG_135 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_136 = { 1, 6, 30, 200, dialog_text_DIALOG_136 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_137 = { 1, 6, 30, 200, dialog_text_DIALOG_137 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_138 = { 1, 3, 30, 200, dialog_text_DIALOG_138 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_139 = { 1, 6, 30, 200, dialog_text_DIALOG_139 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_140 = { 1, 6, 30, 200, dialog_text_DIALOG_140 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_141 = { 1, 5, 150, 200, dialog_text_DIALOG_141 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_142 = { 1, 5, 150, 200, dialog_text_DIALOG_142 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_143 = { 1, 6, 150, 200, dialog_text_DIALOG_143 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_144 = { 1, 6, 150, 200, dialog_text_DIALOG_144 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_145 = { 1, 6, 150, 200, dialog_text_DIALOG_145 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_146 = { 1, 6, 150, 200, dialog_text_DIALOG_146 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_147 = { 1, 5, 30, 200, dialog_text_DIALOG_147 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_148 = { 1, 6, 30, 200, dialog_text_DIALOG_148 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_149 = { 1, 3, 30, 200, dialog_text_DIALOG_149 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_150 = { 1, 5, 30, 200, dialog_text_DIALOG_150 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_151 = { 1, 4, 30, 200, dialog_text_DIALOG_151 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_152 = { 1, 3, 30, 200, dialog_text_DIALOG_152 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_153 = { 1, 4, 30, 200, dialog_text_DIALOG_153 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_154 = { 1, 5, 30, 200, dialog_text_DIALOG_154 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_155 = { 1, 6, 30, 200, dialog_text_DIALOG_155 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_156 = { 1, 5, 30, 200, dialog_text_DIALOG_156 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_157 = { 1, 5, 30, 200, dialog_text_DIALOG_157 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_158 = { 1, 6, 30, 200, dialog_text_DIALOG_158 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_159 = { 1, 6, 30, 200, dialog_text_DIALOG_159 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_160 = { 1, 4, 30, 200, dialog_text_DIALOG_160 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_161 = { 1, 4, 30, 200, dialog_text_DIALOG_161 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_162 = { 1, 4, 30, 200, dialog_text_DIALOG_162 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_163 = { 1, 5, 30, 200, dialog_text_DIALOG_163 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_164 = { 1, 4, 30, 200, dialog_text_DIALOG_164 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_165 = { 1, 5, 30, 200, dialog_text_DIALOG_165 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_166 = { 1, 4, 30, 200, dialog_text_DIALOG_166 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_167 = { 1, 4, 30, 200, dialog_text_DIALOG_167 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_168 = { 1, 5, 30, 200, dialog_text_DIALOG_168 };
+static const struct DialogEntry dialog_entry_orig_DIALOG_169 = { 1, 4, 30, 200, dialog_text_DIALOG_169 };
+static struct DialogEntry dialog_entry_DIALOG_000 = { 1, 6, 30, 200, dialog_text_DIALOG_000 };
+static struct DialogEntry dialog_entry_DIALOG_001 = { 1, 4, 95, 200, dialog_text_DIALOG_001 };
+static struct DialogEntry dialog_entry_DIALOG_002 = { 1, 4, 95, 200, dialog_text_DIALOG_002 };
+static struct DialogEntry dialog_entry_DIALOG_003 = { 1, 5, 95, 200, dialog_text_DIALOG_003 };
+static struct DialogEntry dialog_entry_DIALOG_004 = { 1, 3, 95, 200, dialog_text_DIALOG_004 };
+static struct DialogEntry dialog_entry_DIALOG_005 = { 1, 3, 30, 200, dialog_text_DIALOG_005 };
+static struct DialogEntry dialog_entry_DIALOG_006 = { 1, 3, 30, 200, dialog_text_DIALOG_006 };
+static struct DialogEntry dialog_entry_DIALOG_007 = { 1, 5, 30, 200, dialog_text_DIALOG_007 };
+static struct DialogEntry dialog_entry_DIALOG_008 = { 1, 4, 30, 200, dialog_text_DIALOG_008 };
+static struct DialogEntry dialog_entry_DIALOG_009 = { 1, 5, 30, 200, dialog_text_DIALOG_009 };
+static struct DialogEntry dialog_entry_DIALOG_010 = { 1, 4, 30, 200, dialog_text_DIALOG_010 };
+static struct DialogEntry dialog_entry_DIALOG_011 = { 1, 4, 30, 200, dialog_text_DIALOG_011 };
+static struct DialogEntry dialog_entry_DIALOG_012 = { 1, 4, 30, 200, dialog_text_DIALOG_012 };
+static struct DialogEntry dialog_entry_DIALOG_013 = { 1, 5, 30, 200, dialog_text_DIALOG_013 };
+static struct DialogEntry dialog_entry_DIALOG_014 = { 1, 4, 30, 200, dialog_text_DIALOG_014 };
+static struct DialogEntry dialog_entry_DIALOG_015 = { 1, 4, 30, 200, dialog_text_DIALOG_015 };
+static struct DialogEntry dialog_entry_DIALOG_016 = { 1, 3, 30, 200, dialog_text_DIALOG_016 };
+static struct DialogEntry dialog_entry_DIALOG_017 = { 1, 4, 30, 200, dialog_text_DIALOG_017 };
+static struct DialogEntry dialog_entry_DIALOG_018 = { 1, 4, 30, 200, dialog_text_DIALOG_018 };
+static struct DialogEntry dialog_entry_DIALOG_019 = { 1, 2, 30, 200, dialog_text_DIALOG_019 };
+static struct DialogEntry dialog_entry_DIALOG_020 = { 1, 6, 95, 150, dialog_text_DIALOG_020 };
+static struct DialogEntry dialog_entry_DIALOG_021 = { 1, 5, 95, 200, dialog_text_DIALOG_021 };
+static struct DialogEntry dialog_entry_DIALOG_022 = { 1, 2, 95, 200, dialog_text_DIALOG_022 };
+static struct DialogEntry dialog_entry_DIALOG_023 = { 1, 3, 95, 200, dialog_text_DIALOG_023 };
+static struct DialogEntry dialog_entry_DIALOG_024 = { 1, 5, 95, 200, dialog_text_DIALOG_024 };
+static struct DialogEntry dialog_entry_DIALOG_025 = { 1, 4, 95, 200, dialog_text_DIALOG_025 };
+static struct DialogEntry dialog_entry_DIALOG_026 = { 1, 4, 95, 200, dialog_text_DIALOG_026 };
+static struct DialogEntry dialog_entry_DIALOG_027 = { 1, 4, 95, 200, dialog_text_DIALOG_027 };
+static struct DialogEntry dialog_entry_DIALOG_028 = { 1, 4, 95, 200, dialog_text_DIALOG_028 };
+static struct DialogEntry dialog_entry_DIALOG_029 = { 1, 5, 95, 200, dialog_text_DIALOG_029 };
+static struct DialogEntry dialog_entry_DIALOG_030 = { 1, 6, 30, 200, dialog_text_DIALOG_030 };
+static struct DialogEntry dialog_entry_DIALOG_031 = { 1, 5, 30, 200, dialog_text_DIALOG_031 };
+static struct DialogEntry dialog_entry_DIALOG_032 = { 1, 5, 30, 200, dialog_text_DIALOG_032 };
+static struct DialogEntry dialog_entry_DIALOG_033 = { 1, 6, 30, 200, dialog_text_DIALOG_033 };
+static struct DialogEntry dialog_entry_DIALOG_034 = { 1, 6, 30, 200, dialog_text_DIALOG_034 };
+static struct DialogEntry dialog_entry_DIALOG_035 = { 1, 5, 30, 200, dialog_text_DIALOG_035 };
+static struct DialogEntry dialog_entry_DIALOG_036 = { 1, 5, 30, 200, dialog_text_DIALOG_036 };
+static struct DialogEntry dialog_entry_DIALOG_037 = { 1, 2, 30, 200, dialog_text_DIALOG_037 };
+static struct DialogEntry dialog_entry_DIALOG_038 = { 1, 3, 95, 200, dialog_text_DIALOG_038 };
+static struct DialogEntry dialog_entry_DIALOG_039 = { 1, 4, 30, 200, dialog_text_DIALOG_039 };
+static struct DialogEntry dialog_entry_DIALOG_040 = { 1, 3, 30, 200, dialog_text_DIALOG_040 };
+static struct DialogEntry dialog_entry_DIALOG_041 = { 1, 3, 30, 200, dialog_text_DIALOG_041 };
+static struct DialogEntry dialog_entry_DIALOG_042 = { 1, 4, 30, 200, dialog_text_DIALOG_042 };
+static struct DialogEntry dialog_entry_DIALOG_043 = { 1, 5, 30, 200, dialog_text_DIALOG_043 };
+static struct DialogEntry dialog_entry_DIALOG_044 = { 1, 5, 95, 200, dialog_text_DIALOG_044 };
+static struct DialogEntry dialog_entry_DIALOG_045 = { 1, 6, 95, 200, dialog_text_DIALOG_045 };
+static struct DialogEntry dialog_entry_DIALOG_046 = { 1, 5, 30, 200, dialog_text_DIALOG_046 };
+static struct DialogEntry dialog_entry_DIALOG_047 = { 1, 2, 95, 200, dialog_text_DIALOG_047 };
+static struct DialogEntry dialog_entry_DIALOG_048 = { 1, 4, 30, 200, dialog_text_DIALOG_048 };
+static struct DialogEntry dialog_entry_DIALOG_049 = { 1, 5, 30, 200, dialog_text_DIALOG_049 };
+static struct DialogEntry dialog_entry_DIALOG_050 = { 1, 4, 30, 200, dialog_text_DIALOG_050 };
+static struct DialogEntry dialog_entry_DIALOG_051 = { 1, 6, 30, 200, dialog_text_DIALOG_051 };
+static struct DialogEntry dialog_entry_DIALOG_052 = { 1, 5, 30, 200, dialog_text_DIALOG_052 };
+static struct DialogEntry dialog_entry_DIALOG_053 = { 1, 5, 30, 200, dialog_text_DIALOG_053 };
+static struct DialogEntry dialog_entry_DIALOG_054 = { 1, 5, 30, 200, dialog_text_DIALOG_054 };
+static struct DialogEntry dialog_entry_DIALOG_055 = { 1, 4, 30, 200, dialog_text_DIALOG_055 };
+static struct DialogEntry dialog_entry_DIALOG_056 = { 1, 6, 30, 200, dialog_text_DIALOG_056 };
+static struct DialogEntry dialog_entry_DIALOG_057 = { 1, 4, 30, 200, dialog_text_DIALOG_057 };
+static struct DialogEntry dialog_entry_DIALOG_058 = { 1, 4, 30, 200, dialog_text_DIALOG_058 };
+static struct DialogEntry dialog_entry_DIALOG_059 = { 1, 4, 30, 200, dialog_text_DIALOG_059 };
+static struct DialogEntry dialog_entry_DIALOG_060 = { 1, 4, 30, 200, dialog_text_DIALOG_060 };
+static struct DialogEntry dialog_entry_DIALOG_061 = { 1, 4, 30, 200, dialog_text_DIALOG_061 };
+static struct DialogEntry dialog_entry_DIALOG_062 = { 1, 3, 30, 200, dialog_text_DIALOG_062 };
+static struct DialogEntry dialog_entry_DIALOG_063 = { 1, 5, 30, 200, dialog_text_DIALOG_063 };
+static struct DialogEntry dialog_entry_DIALOG_064 = { 1, 5, 30, 200, dialog_text_DIALOG_064 };
+static struct DialogEntry dialog_entry_DIALOG_065 = { 1, 6, 30, 200, dialog_text_DIALOG_065 };
+static struct DialogEntry dialog_entry_DIALOG_066 = { 1, 5, 30, 200, dialog_text_DIALOG_066 };
+static struct DialogEntry dialog_entry_DIALOG_067 = { 1, 5, 30, 200, dialog_text_DIALOG_067 };
+static struct DialogEntry dialog_entry_DIALOG_068 = { 1, 5, 30, 200, dialog_text_DIALOG_068 };
+static struct DialogEntry dialog_entry_DIALOG_069 = { 1, 6, 30, 200, dialog_text_DIALOG_069 };
+static struct DialogEntry dialog_entry_DIALOG_070 = { 1, 5, 30, 200, dialog_text_DIALOG_070 };
+static struct DialogEntry dialog_entry_DIALOG_071 = { 1, 3, 30, 200, dialog_text_DIALOG_071 };
+static struct DialogEntry dialog_entry_DIALOG_072 = { 1, 5, 30, 200, dialog_text_DIALOG_072 };
+static struct DialogEntry dialog_entry_DIALOG_073 = { 1, 4, 95, 200, dialog_text_DIALOG_073 };
+static struct DialogEntry dialog_entry_DIALOG_074 = { 1, 5, 30, 200, dialog_text_DIALOG_074 };
+static struct DialogEntry dialog_entry_DIALOG_075 = { 1, 5, 30, 200, dialog_text_DIALOG_075 };
+static struct DialogEntry dialog_entry_DIALOG_076 = { 1, 6, 30, 200, dialog_text_DIALOG_076 };
+static struct DialogEntry dialog_entry_DIALOG_077 = { 1, 2, 150, 200, dialog_text_DIALOG_077 };
+static struct DialogEntry dialog_entry_DIALOG_078 = { 1, 5, 30, 200, dialog_text_DIALOG_078 };
+static struct DialogEntry dialog_entry_DIALOG_079 = { 1, 4, 30, 200, dialog_text_DIALOG_079 };
+static struct DialogEntry dialog_entry_DIALOG_080 = { 1, 1, 30, 200, dialog_text_DIALOG_080 };
+static struct DialogEntry dialog_entry_DIALOG_081 = { 1, 4, 30, 200, dialog_text_DIALOG_081 };
+static struct DialogEntry dialog_entry_DIALOG_082 = { 1, 4, 30, 200, dialog_text_DIALOG_082 };
+static struct DialogEntry dialog_entry_DIALOG_083 = { 1, 6, 30, 200, dialog_text_DIALOG_083 };
+static struct DialogEntry dialog_entry_DIALOG_084 = { 1, 3, 30, 200, dialog_text_DIALOG_084 };
+static struct DialogEntry dialog_entry_DIALOG_085 = { 1, 5, 30, 200, dialog_text_DIALOG_085 };
+static struct DialogEntry dialog_entry_DIALOG_086 = { 1, 3, 30, 200, dialog_text_DIALOG_086 };
+static struct DialogEntry dialog_entry_DIALOG_087 = { 1, 4, 30, 200, dialog_text_DIALOG_087 };
+static struct DialogEntry dialog_entry_DIALOG_088 = { 1, 5, 30, 200, dialog_text_DIALOG_088 };
+static struct DialogEntry dialog_entry_DIALOG_089 = { 1, 5, 95, 200, dialog_text_DIALOG_089 };
+static struct DialogEntry dialog_entry_DIALOG_090 = { 1, 6, 30, 200, dialog_text_DIALOG_090 };
+static struct DialogEntry dialog_entry_DIALOG_091 = { 2, 2, 30, 200, dialog_text_DIALOG_091 };
+static struct DialogEntry dialog_entry_DIALOG_092 = { 1, 5, 30, 200, dialog_text_DIALOG_092 };
+static struct DialogEntry dialog_entry_DIALOG_093 = { 1, 5, 30, 200, dialog_text_DIALOG_093 };
+static struct DialogEntry dialog_entry_DIALOG_094 = { 1, 4, 30, 200, dialog_text_DIALOG_094 };
+static struct DialogEntry dialog_entry_DIALOG_095 = { 1, 4, 30, 200, dialog_text_DIALOG_095 };
+static struct DialogEntry dialog_entry_DIALOG_096 = { 1, 4, 30, 200, dialog_text_DIALOG_096 };
+static struct DialogEntry dialog_entry_DIALOG_097 = { 1, 5, 30, 200, dialog_text_DIALOG_097 };
+static struct DialogEntry dialog_entry_DIALOG_098 = { 1, 2, 95, 200, dialog_text_DIALOG_098 };
+static struct DialogEntry dialog_entry_DIALOG_099 = { 1, 5, 95, 200, dialog_text_DIALOG_099 };
+static struct DialogEntry dialog_entry_DIALOG_100 = { 1, 3, 95, 200, dialog_text_DIALOG_100 };
+static struct DialogEntry dialog_entry_DIALOG_101 = { 1, 3, 95, 200, dialog_text_DIALOG_101 };
+static struct DialogEntry dialog_entry_DIALOG_102 = { 1, 5, 30, 200, dialog_text_DIALOG_102 };
+static struct DialogEntry dialog_entry_DIALOG_103 = { 1, 4, 95, 200, dialog_text_DIALOG_103 };
+static struct DialogEntry dialog_entry_DIALOG_104 = { 1, 5, 30, 200, dialog_text_DIALOG_104 };
+static struct DialogEntry dialog_entry_DIALOG_105 = { 1, 3, 95, 200, dialog_text_DIALOG_105 };
+static struct DialogEntry dialog_entry_DIALOG_106 = { 1, 2, 95, 200, dialog_text_DIALOG_106 };
+static struct DialogEntry dialog_entry_DIALOG_107 = { 1, 3, 95, 200, dialog_text_DIALOG_107 };
+static struct DialogEntry dialog_entry_DIALOG_108 = { 1, 2, 95, 200, dialog_text_DIALOG_108 };
+static struct DialogEntry dialog_entry_DIALOG_109 = { 1, 4, 95, 200, dialog_text_DIALOG_109 };
+static struct DialogEntry dialog_entry_DIALOG_110 = { 1, 5, 95, 200, dialog_text_DIALOG_110 };
+static struct DialogEntry dialog_entry_DIALOG_111 = { 1, 4, 95, 200, dialog_text_DIALOG_111 };
+static struct DialogEntry dialog_entry_DIALOG_112 = { 1, 4, 30, 200, dialog_text_DIALOG_112 };
+static struct DialogEntry dialog_entry_DIALOG_113 = { 1, 6, 30, 200, dialog_text_DIALOG_113 };
+static struct DialogEntry dialog_entry_DIALOG_114 = { 1, 5, 95, 200, dialog_text_DIALOG_114 };
+static struct DialogEntry dialog_entry_DIALOG_115 = { 1, 5, 95, 200, dialog_text_DIALOG_115 };
+static struct DialogEntry dialog_entry_DIALOG_116 = { 1, 5, 95, 200, dialog_text_DIALOG_116 };
+static struct DialogEntry dialog_entry_DIALOG_117 = { 1, 1, 95, 200, dialog_text_DIALOG_117 };
+static struct DialogEntry dialog_entry_DIALOG_118 = { 1, 6, 95, 200, dialog_text_DIALOG_118 };
+static struct DialogEntry dialog_entry_DIALOG_119 = { 1, 6, 30, 200, dialog_text_DIALOG_119 };
+static struct DialogEntry dialog_entry_DIALOG_120 = { 1, 4, 30, 200, dialog_text_DIALOG_120 };
+static struct DialogEntry dialog_entry_DIALOG_121 = { 1, 5, 30, 200, dialog_text_DIALOG_121 };
+static struct DialogEntry dialog_entry_DIALOG_122 = { 1, 4, 30, 200, dialog_text_DIALOG_122 };
+static struct DialogEntry dialog_entry_DIALOG_123 = { 1, 4, 30, 200, dialog_text_DIALOG_123 };
+static struct DialogEntry dialog_entry_DIALOG_124 = { 1, 4, 30, 200, dialog_text_DIALOG_124 };
+static struct DialogEntry dialog_entry_DIALOG_125 = { 1, 3, 30, 200, dialog_text_DIALOG_125 };
+static struct DialogEntry dialog_entry_DIALOG_126 = { 2, 3, 30, 200, dialog_text_DIALOG_126 };
+static struct DialogEntry dialog_entry_DIALOG_127 = { 3, 4, 30, 200, dialog_text_DIALOG_127 };
+static struct DialogEntry dialog_entry_DIALOG_128 = { 1, 4, 95, 200, dialog_text_DIALOG_128 };
+static struct DialogEntry dialog_entry_DIALOG_129 = { 1, 5, 30, 200, dialog_text_DIALOG_129 };
+static struct DialogEntry dialog_entry_DIALOG_130 = { 1, 5, 30, 200, dialog_text_DIALOG_130 };
+static struct DialogEntry dialog_entry_DIALOG_131 = { 1, 5, 30, 200, dialog_text_DIALOG_131 };
+static struct DialogEntry dialog_entry_DIALOG_132 = { 1, 4, 30, 200, dialog_text_DIALOG_132 };
+static struct DialogEntry dialog_entry_DIALOG_133 = { 1, 6, 30, 200, dialog_text_DIALOG_133 };
+static struct DialogEntry dialog_entry_DIALOG_134 = { 1, 5, 30, 200, dialog_text_DIALOG_134 };
+static struct DialogEntry dialog_entry_DIALOG_135 = { 1, 5, 30, 200, dialog_text_DIALOG_135 };
+static struct DialogEntry dialog_entry_DIALOG_136 = { 1, 6, 30, 200, dialog_text_DIALOG_136 };
+static struct DialogEntry dialog_entry_DIALOG_137 = { 1, 6, 30, 200, dialog_text_DIALOG_137 };
+static struct DialogEntry dialog_entry_DIALOG_138 = { 1, 3, 30, 200, dialog_text_DIALOG_138 };
+static struct DialogEntry dialog_entry_DIALOG_139 = { 1, 6, 30, 200, dialog_text_DIALOG_139 };
+static struct DialogEntry dialog_entry_DIALOG_140 = { 1, 6, 30, 200, dialog_text_DIALOG_140 };
+static struct DialogEntry dialog_entry_DIALOG_141 = { 1, 5, 150, 200, dialog_text_DIALOG_141 };
+static struct DialogEntry dialog_entry_DIALOG_142 = { 1, 5, 150, 200, dialog_text_DIALOG_142 };
+static struct DialogEntry dialog_entry_DIALOG_143 = { 1, 6, 150, 200, dialog_text_DIALOG_143 };
+static struct DialogEntry dialog_entry_DIALOG_144 = { 1, 6, 150, 200, dialog_text_DIALOG_144 };
+static struct DialogEntry dialog_entry_DIALOG_145 = { 1, 6, 150, 200, dialog_text_DIALOG_145 };
+static struct DialogEntry dialog_entry_DIALOG_146 = { 1, 6, 150, 200, dialog_text_DIALOG_146 };
+static struct DialogEntry dialog_entry_DIALOG_147 = { 1, 5, 30, 200, dialog_text_DIALOG_147 };
+static struct DialogEntry dialog_entry_DIALOG_148 = { 1, 6, 30, 200, dialog_text_DIALOG_148 };
+static struct DialogEntry dialog_entry_DIALOG_149 = { 1, 3, 30, 200, dialog_text_DIALOG_149 };
+static struct DialogEntry dialog_entry_DIALOG_150 = { 1, 5, 30, 200, dialog_text_DIALOG_150 };
+static struct DialogEntry dialog_entry_DIALOG_151 = { 1, 4, 30, 200, dialog_text_DIALOG_151 };
+static struct DialogEntry dialog_entry_DIALOG_152 = { 1, 3, 30, 200, dialog_text_DIALOG_152 };
+static struct DialogEntry dialog_entry_DIALOG_153 = { 1, 4, 30, 200, dialog_text_DIALOG_153 };
+static struct DialogEntry dialog_entry_DIALOG_154 = { 1, 5, 30, 200, dialog_text_DIALOG_154 };
+static struct DialogEntry dialog_entry_DIALOG_155 = { 1, 6, 30, 200, dialog_text_DIALOG_155 };
+static struct DialogEntry dialog_entry_DIALOG_156 = { 1, 5, 30, 200, dialog_text_DIALOG_156 };
+static struct DialogEntry dialog_entry_DIALOG_157 = { 1, 5, 30, 200, dialog_text_DIALOG_157 };
+static struct DialogEntry dialog_entry_DIALOG_158 = { 1, 6, 30, 200, dialog_text_DIALOG_158 };
+static struct DialogEntry dialog_entry_DIALOG_159 = { 1, 6, 30, 200, dialog_text_DIALOG_159 };
+static struct DialogEntry dialog_entry_DIALOG_160 = { 1, 4, 30, 200, dialog_text_DIALOG_160 };
+static struct DialogEntry dialog_entry_DIALOG_161 = { 1, 4, 30, 200, dialog_text_DIALOG_161 };
+static struct DialogEntry dialog_entry_DIALOG_162 = { 1, 4, 30, 200, dialog_text_DIALOG_162 };
+static struct DialogEntry dialog_entry_DIALOG_163 = { 1, 5, 30, 200, dialog_text_DIALOG_163 };
+static struct DialogEntry dialog_entry_DIALOG_164 = { 1, 4, 30, 200, dialog_text_DIALOG_164 };
+static struct DialogEntry dialog_entry_DIALOG_165 = { 1, 5, 30, 200, dialog_text_DIALOG_165 };
+static struct DialogEntry dialog_entry_DIALOG_166 = { 1, 4, 30, 200, dialog_text_DIALOG_166 };
+static struct DialogEntry dialog_entry_DIALOG_167 = { 1, 4, 30, 200, dialog_text_DIALOG_167 };
+static struct DialogEntry dialog_entry_DIALOG_168 = { 1, 5, 30, 200, dialog_text_DIALOG_168 };
+static struct DialogEntry dialog_entry_DIALOG_169 = { 1, 4, 30, 200, dialog_text_DIALOG_169 };
+const struct DialogEntry *const seg2_dialog_original[] = {
+&dialog_entry_orig_DIALOG_000,
+&dialog_entry_orig_DIALOG_001,
+&dialog_entry_orig_DIALOG_002,
+&dialog_entry_orig_DIALOG_003,
+&dialog_entry_orig_DIALOG_004,
+&dialog_entry_orig_DIALOG_005,
+&dialog_entry_orig_DIALOG_006,
+&dialog_entry_orig_DIALOG_007,
+&dialog_entry_orig_DIALOG_008,
+&dialog_entry_orig_DIALOG_009,
+&dialog_entry_orig_DIALOG_010,
+&dialog_entry_orig_DIALOG_011,
+&dialog_entry_orig_DIALOG_012,
+&dialog_entry_orig_DIALOG_013,
+&dialog_entry_orig_DIALOG_014,
+&dialog_entry_orig_DIALOG_015,
+&dialog_entry_orig_DIALOG_016,
+&dialog_entry_orig_DIALOG_017,
+&dialog_entry_orig_DIALOG_018,
+&dialog_entry_orig_DIALOG_019,
+&dialog_entry_orig_DIALOG_020,
+&dialog_entry_orig_DIALOG_021,
+&dialog_entry_orig_DIALOG_022,
+&dialog_entry_orig_DIALOG_023,
+&dialog_entry_orig_DIALOG_024,
+&dialog_entry_orig_DIALOG_025,
+&dialog_entry_orig_DIALOG_026,
+&dialog_entry_orig_DIALOG_027,
+&dialog_entry_orig_DIALOG_028,
+&dialog_entry_orig_DIALOG_029,
+&dialog_entry_orig_DIALOG_030,
+&dialog_entry_orig_DIALOG_031,
+&dialog_entry_orig_DIALOG_032,
+&dialog_entry_orig_DIALOG_033,
+&dialog_entry_orig_DIALOG_034,
+&dialog_entry_orig_DIALOG_035,
+&dialog_entry_orig_DIALOG_036,
+&dialog_entry_orig_DIALOG_037,
+&dialog_entry_orig_DIALOG_038,
+&dialog_entry_orig_DIALOG_039,
+&dialog_entry_orig_DIALOG_040,
+&dialog_entry_orig_DIALOG_041,
+&dialog_entry_orig_DIALOG_042,
+&dialog_entry_orig_DIALOG_043,
+&dialog_entry_orig_DIALOG_044,
+&dialog_entry_orig_DIALOG_045,
+&dialog_entry_orig_DIALOG_046,
+&dialog_entry_orig_DIALOG_047,
+&dialog_entry_orig_DIALOG_048,
+&dialog_entry_orig_DIALOG_049,
+&dialog_entry_orig_DIALOG_050,
+&dialog_entry_orig_DIALOG_051,
+&dialog_entry_orig_DIALOG_052,
+&dialog_entry_orig_DIALOG_053,
+&dialog_entry_orig_DIALOG_054,
+&dialog_entry_orig_DIALOG_055,
+&dialog_entry_orig_DIALOG_056,
+&dialog_entry_orig_DIALOG_057,
+&dialog_entry_orig_DIALOG_058,
+&dialog_entry_orig_DIALOG_059,
+&dialog_entry_orig_DIALOG_060,
+&dialog_entry_orig_DIALOG_061,
+&dialog_entry_orig_DIALOG_062,
+&dialog_entry_orig_DIALOG_063,
+&dialog_entry_orig_DIALOG_064,
+&dialog_entry_orig_DIALOG_065,
+&dialog_entry_orig_DIALOG_066,
+&dialog_entry_orig_DIALOG_067,
+&dialog_entry_orig_DIALOG_068,
+&dialog_entry_orig_DIALOG_069,
+&dialog_entry_orig_DIALOG_070,
+&dialog_entry_orig_DIALOG_071,
+&dialog_entry_orig_DIALOG_072,
+&dialog_entry_orig_DIALOG_073,
+&dialog_entry_orig_DIALOG_074,
+&dialog_entry_orig_DIALOG_075,
+&dialog_entry_orig_DIALOG_076,
+&dialog_entry_orig_DIALOG_077,
+&dialog_entry_orig_DIALOG_078,
+&dialog_entry_orig_DIALOG_079,
+&dialog_entry_orig_DIALOG_080,
+&dialog_entry_orig_DIALOG_081,
+&dialog_entry_orig_DIALOG_082,
+&dialog_entry_orig_DIALOG_083,
+&dialog_entry_orig_DIALOG_084,
+&dialog_entry_orig_DIALOG_085,
+&dialog_entry_orig_DIALOG_086,
+&dialog_entry_orig_DIALOG_087,
+&dialog_entry_orig_DIALOG_088,
+&dialog_entry_orig_DIALOG_089,
+&dialog_entry_orig_DIALOG_090,
+&dialog_entry_orig_DIALOG_091,
+&dialog_entry_orig_DIALOG_092,
+&dialog_entry_orig_DIALOG_093,
+&dialog_entry_orig_DIALOG_094,
+&dialog_entry_orig_DIALOG_095,
+&dialog_entry_orig_DIALOG_096,
+&dialog_entry_orig_DIALOG_097,
+&dialog_entry_orig_DIALOG_098,
+&dialog_entry_orig_DIALOG_099,
+&dialog_entry_orig_DIALOG_100,
+&dialog_entry_orig_DIALOG_101,
+&dialog_entry_orig_DIALOG_102,
+&dialog_entry_orig_DIALOG_103,
+&dialog_entry_orig_DIALOG_104,
+&dialog_entry_orig_DIALOG_105,
+&dialog_entry_orig_DIALOG_106,
+&dialog_entry_orig_DIALOG_107,
+&dialog_entry_orig_DIALOG_108,
+&dialog_entry_orig_DIALOG_109,
+&dialog_entry_orig_DIALOG_110,
+&dialog_entry_orig_DIALOG_111,
+&dialog_entry_orig_DIALOG_112,
+&dialog_entry_orig_DIALOG_113,
+&dialog_entry_orig_DIALOG_114,
+&dialog_entry_orig_DIALOG_115,
+&dialog_entry_orig_DIALOG_116,
+&dialog_entry_orig_DIALOG_117,
+&dialog_entry_orig_DIALOG_118,
+&dialog_entry_orig_DIALOG_119,
+&dialog_entry_orig_DIALOG_120,
+&dialog_entry_orig_DIALOG_121,
+&dialog_entry_orig_DIALOG_122,
+&dialog_entry_orig_DIALOG_123,
+&dialog_entry_orig_DIALOG_124,
+&dialog_entry_orig_DIALOG_125,
+&dialog_entry_orig_DIALOG_126,
+&dialog_entry_orig_DIALOG_127,
+&dialog_entry_orig_DIALOG_128,
+&dialog_entry_orig_DIALOG_129,
+&dialog_entry_orig_DIALOG_130,
+&dialog_entry_orig_DIALOG_131,
+&dialog_entry_orig_DIALOG_132,
+&dialog_entry_orig_DIALOG_133,
+&dialog_entry_orig_DIALOG_134,
+&dialog_entry_orig_DIALOG_135,
+&dialog_entry_orig_DIALOG_136,
+&dialog_entry_orig_DIALOG_137,
+&dialog_entry_orig_DIALOG_138,
+&dialog_entry_orig_DIALOG_139,
+&dialog_entry_orig_DIALOG_140,
+&dialog_entry_orig_DIALOG_141,
+&dialog_entry_orig_DIALOG_142,
+&dialog_entry_orig_DIALOG_143,
+&dialog_entry_orig_DIALOG_144,
+&dialog_entry_orig_DIALOG_145,
+&dialog_entry_orig_DIALOG_146,
+&dialog_entry_orig_DIALOG_147,
+&dialog_entry_orig_DIALOG_148,
+&dialog_entry_orig_DIALOG_149,
+&dialog_entry_orig_DIALOG_150,
+&dialog_entry_orig_DIALOG_151,
+&dialog_entry_orig_DIALOG_152,
+&dialog_entry_orig_DIALOG_153,
+&dialog_entry_orig_DIALOG_154,
+&dialog_entry_orig_DIALOG_155,
+&dialog_entry_orig_DIALOG_156,
+&dialog_entry_orig_DIALOG_157,
+&dialog_entry_orig_DIALOG_158,
+&dialog_entry_orig_DIALOG_159,
+&dialog_entry_orig_DIALOG_160,
+&dialog_entry_orig_DIALOG_161,
+&dialog_entry_orig_DIALOG_162,
+&dialog_entry_orig_DIALOG_163,
+&dialog_entry_orig_DIALOG_164,
+&dialog_entry_orig_DIALOG_165,
+&dialog_entry_orig_DIALOG_166,
+&dialog_entry_orig_DIALOG_167,
+&dialog_entry_orig_DIALOG_168,
+&dialog_entry_orig_DIALOG_169,
+    NULL
+};
+const struct DialogEntry *const seg2_dialog_table[] = {
+&dialog_entry_DIALOG_000,
+&dialog_entry_DIALOG_001,
+&dialog_entry_DIALOG_002,
+&dialog_entry_DIALOG_003,
+&dialog_entry_DIALOG_004,
+&dialog_entry_DIALOG_005,
+&dialog_entry_DIALOG_006,
+&dialog_entry_DIALOG_007,
+&dialog_entry_DIALOG_008,
+&dialog_entry_DIALOG_009,
+&dialog_entry_DIALOG_010,
+&dialog_entry_DIALOG_011,
+&dialog_entry_DIALOG_012,
+&dialog_entry_DIALOG_013,
+&dialog_entry_DIALOG_014,
+&dialog_entry_DIALOG_015,
+&dialog_entry_DIALOG_016,
+&dialog_entry_DIALOG_017,
+&dialog_entry_DIALOG_018,
+&dialog_entry_DIALOG_019,
+&dialog_entry_DIALOG_020,
+&dialog_entry_DIALOG_021,
+&dialog_entry_DIALOG_022,
+&dialog_entry_DIALOG_023,
+&dialog_entry_DIALOG_024,
+&dialog_entry_DIALOG_025,
+&dialog_entry_DIALOG_026,
+&dialog_entry_DIALOG_027,
+&dialog_entry_DIALOG_028,
+&dialog_entry_DIALOG_029,
+&dialog_entry_DIALOG_030,
+&dialog_entry_DIALOG_031,
+&dialog_entry_DIALOG_032,
+&dialog_entry_DIALOG_033,
+&dialog_entry_DIALOG_034,
+&dialog_entry_DIALOG_035,
+&dialog_entry_DIALOG_036,
+&dialog_entry_DIALOG_037,
+&dialog_entry_DIALOG_038,
+&dialog_entry_DIALOG_039,
+&dialog_entry_DIALOG_040,
+&dialog_entry_DIALOG_041,
+&dialog_entry_DIALOG_042,
+&dialog_entry_DIALOG_043,
+&dialog_entry_DIALOG_044,
+&dialog_entry_DIALOG_045,
+&dialog_entry_DIALOG_046,
+&dialog_entry_DIALOG_047,
+&dialog_entry_DIALOG_048,
+&dialog_entry_DIALOG_049,
+&dialog_entry_DIALOG_050,
+&dialog_entry_DIALOG_051,
+&dialog_entry_DIALOG_052,
+&dialog_entry_DIALOG_053,
+&dialog_entry_DIALOG_054,
+&dialog_entry_DIALOG_055,
+&dialog_entry_DIALOG_056,
+&dialog_entry_DIALOG_057,
+&dialog_entry_DIALOG_058,
+&dialog_entry_DIALOG_059,
+&dialog_entry_DIALOG_060,
+&dialog_entry_DIALOG_061,
+&dialog_entry_DIALOG_062,
+&dialog_entry_DIALOG_063,
+&dialog_entry_DIALOG_064,
+&dialog_entry_DIALOG_065,
+&dialog_entry_DIALOG_066,
+&dialog_entry_DIALOG_067,
+&dialog_entry_DIALOG_068,
+&dialog_entry_DIALOG_069,
+&dialog_entry_DIALOG_070,
+&dialog_entry_DIALOG_071,
+&dialog_entry_DIALOG_072,
+&dialog_entry_DIALOG_073,
+&dialog_entry_DIALOG_074,
+&dialog_entry_DIALOG_075,
+&dialog_entry_DIALOG_076,
+&dialog_entry_DIALOG_077,
+&dialog_entry_DIALOG_078,
+&dialog_entry_DIALOG_079,
+&dialog_entry_DIALOG_080,
+&dialog_entry_DIALOG_081,
+&dialog_entry_DIALOG_082,
+&dialog_entry_DIALOG_083,
+&dialog_entry_DIALOG_084,
+&dialog_entry_DIALOG_085,
+&dialog_entry_DIALOG_086,
+&dialog_entry_DIALOG_087,
+&dialog_entry_DIALOG_088,
+&dialog_entry_DIALOG_089,
+&dialog_entry_DIALOG_090,
+&dialog_entry_DIALOG_091,
+&dialog_entry_DIALOG_092,
+&dialog_entry_DIALOG_093,
+&dialog_entry_DIALOG_094,
+&dialog_entry_DIALOG_095,
+&dialog_entry_DIALOG_096,
+&dialog_entry_DIALOG_097,
+&dialog_entry_DIALOG_098,
+&dialog_entry_DIALOG_099,
+&dialog_entry_DIALOG_100,
+&dialog_entry_DIALOG_101,
+&dialog_entry_DIALOG_102,
+&dialog_entry_DIALOG_103,
+&dialog_entry_DIALOG_104,
+&dialog_entry_DIALOG_105,
+&dialog_entry_DIALOG_106,
+&dialog_entry_DIALOG_107,
+&dialog_entry_DIALOG_108,
+&dialog_entry_DIALOG_109,
+&dialog_entry_DIALOG_110,
+&dialog_entry_DIALOG_111,
+&dialog_entry_DIALOG_112,
+&dialog_entry_DIALOG_113,
+&dialog_entry_DIALOG_114,
+&dialog_entry_DIALOG_115,
+&dialog_entry_DIALOG_116,
+&dialog_entry_DIALOG_117,
+&dialog_entry_DIALOG_118,
+&dialog_entry_DIALOG_119,
+&dialog_entry_DIALOG_120,
+&dialog_entry_DIALOG_121,
+&dialog_entry_DIALOG_122,
+&dialog_entry_DIALOG_123,
+&dialog_entry_DIALOG_124,
+&dialog_entry_DIALOG_125,
+&dialog_entry_DIALOG_126,
+&dialog_entry_DIALOG_127,
+&dialog_entry_DIALOG_128,
+&dialog_entry_DIALOG_129,
+&dialog_entry_DIALOG_130,
+&dialog_entry_DIALOG_131,
+&dialog_entry_DIALOG_132,
+&dialog_entry_DIALOG_133,
+&dialog_entry_DIALOG_134,
+&dialog_entry_DIALOG_135,
+&dialog_entry_DIALOG_136,
+&dialog_entry_DIALOG_137,
+&dialog_entry_DIALOG_138,
+&dialog_entry_DIALOG_139,
+&dialog_entry_DIALOG_140,
+&dialog_entry_DIALOG_141,
+&dialog_entry_DIALOG_142,
+&dialog_entry_DIALOG_143,
+&dialog_entry_DIALOG_144,
+&dialog_entry_DIALOG_145,
+&dialog_entry_DIALOG_146,
+&dialog_entry_DIALOG_147,
+&dialog_entry_DIALOG_148,
+&dialog_entry_DIALOG_149,
+&dialog_entry_DIALOG_150,
+&dialog_entry_DIALOG_151,
+&dialog_entry_DIALOG_152,
+&dialog_entry_DIALOG_153,
+&dialog_entry_DIALOG_154,
+&dialog_entry_DIALOG_155,
+&dialog_entry_DIALOG_156,
+&dialog_entry_DIALOG_157,
+&dialog_entry_DIALOG_158,
+&dialog_entry_DIALOG_159,
+&dialog_entry_DIALOG_160,
+&dialog_entry_DIALOG_161,
+&dialog_entry_DIALOG_162,
+&dialog_entry_DIALOG_163,
+&dialog_entry_DIALOG_164,
+&dialog_entry_DIALOG_165,
+&dialog_entry_DIALOG_166,
+&dialog_entry_DIALOG_167,
+&dialog_entry_DIALOG_168,
+&dialog_entry_DIALOG_169,
+    NULL
+};
+static u8 GLUE2(seg2_course_name_table, _COURSE_BOB)[23] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_WF)[20] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_JRB)[19] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_CCM)[23] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_BBH)[19] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_HMC)[18] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_LLL)[20] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_SSL)[22] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_DDD)[20] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_SL)[18] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_WDW)[17] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_TTM)[23] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_THI)[20] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_TTC)[19] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_RR)[16] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_BITDW)[28] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_BITFS)[26] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_BITS)[21] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_PSS)[31] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_COTMC)[27] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_TOTWC)[25] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_VCUTM)[29] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_WMOTR)[31] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_SA)[23] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _COURSE_CAKE_END)[1] = { 0xFF };
+static u8 GLUE2(seg2_course_name_table, _castle_secret_stars)[23] = { 0xFF };
+
+
+
+
+
+
+
+const u8* seg2_course_name_table[] = {
+GLUE2(seg2_course_name_table, _COURSE_BOB),
+GLUE2(seg2_course_name_table, _COURSE_WF),
+GLUE2(seg2_course_name_table, _COURSE_JRB),
+GLUE2(seg2_course_name_table, _COURSE_CCM),
+GLUE2(seg2_course_name_table, _COURSE_BBH),
+GLUE2(seg2_course_name_table, _COURSE_HMC),
+GLUE2(seg2_course_name_table, _COURSE_LLL),
+GLUE2(seg2_course_name_table, _COURSE_SSL),
+GLUE2(seg2_course_name_table, _COURSE_DDD),
+GLUE2(seg2_course_name_table, _COURSE_SL),
+GLUE2(seg2_course_name_table, _COURSE_WDW),
+GLUE2(seg2_course_name_table, _COURSE_TTM),
+GLUE2(seg2_course_name_table, _COURSE_THI),
+GLUE2(seg2_course_name_table, _COURSE_TTC),
+GLUE2(seg2_course_name_table, _COURSE_RR),
+GLUE2(seg2_course_name_table, _COURSE_BITDW),
+GLUE2(seg2_course_name_table, _COURSE_BITFS),
+GLUE2(seg2_course_name_table, _COURSE_BITS),
+GLUE2(seg2_course_name_table, _COURSE_PSS),
+GLUE2(seg2_course_name_table, _COURSE_COTMC),
+GLUE2(seg2_course_name_table, _COURSE_TOTWC),
+GLUE2(seg2_course_name_table, _COURSE_VCUTM),
+GLUE2(seg2_course_name_table, _COURSE_WMOTR),
+GLUE2(seg2_course_name_table, _COURSE_SA),
+GLUE2(seg2_course_name_table, _COURSE_CAKE_END),
+GLUE2(seg2_course_name_table, _castle_secret_stars),
+
+
+
+
+
+
+
+    NULL
+};
+const u8* GLUE2(seg2_course_name_table, _original)[] = {
+GLUE2(seg2_course_name_table, _COURSE_BOB),
+GLUE2(seg2_course_name_table, _COURSE_WF),
+GLUE2(seg2_course_name_table, _COURSE_JRB),
+GLUE2(seg2_course_name_table, _COURSE_CCM),
+GLUE2(seg2_course_name_table, _COURSE_BBH),
+GLUE2(seg2_course_name_table, _COURSE_HMC),
+GLUE2(seg2_course_name_table, _COURSE_LLL),
+GLUE2(seg2_course_name_table, _COURSE_SSL),
+GLUE2(seg2_course_name_table, _COURSE_DDD),
+GLUE2(seg2_course_name_table, _COURSE_SL),
+GLUE2(seg2_course_name_table, _COURSE_WDW),
+GLUE2(seg2_course_name_table, _COURSE_TTM),
+GLUE2(seg2_course_name_table, _COURSE_THI),
+GLUE2(seg2_course_name_table, _COURSE_TTC),
+GLUE2(seg2_course_name_table, _COURSE_RR),
+GLUE2(seg2_course_name_table, _COURSE_BITDW),
+GLUE2(seg2_course_name_table, _COURSE_BITFS),
+GLUE2(seg2_course_name_table, _COURSE_BITS),
+GLUE2(seg2_course_name_table, _COURSE_PSS),
+GLUE2(seg2_course_name_table, _COURSE_COTMC),
+GLUE2(seg2_course_name_table, _COURSE_TOTWC),
+GLUE2(seg2_course_name_table, _COURSE_VCUTM),
+GLUE2(seg2_course_name_table, _COURSE_WMOTR),
+GLUE2(seg2_course_name_table, _COURSE_SA),
+GLUE2(seg2_course_name_table, _COURSE_CAKE_END),
+GLUE2(seg2_course_name_table, _castle_secret_stars),
+
+
+
+
+
+
+
+    NULL
+};
+static u8 act_name_COURSE_BOB_1[26] = { 0xFF }; static u8 act_name_COURSE_BOB_2[30] = { 0xFF }; static u8 act_name_COURSE_BOB_3[31] = { 0xFF }; static u8 act_name_COURSE_BOB_4[21] = { 0xFF }; static u8 act_name_COURSE_BOB_5[23] = { 0xFF }; static u8 act_name_COURSE_BOB_6[26] = { 0xFF };
+static u8 act_name_COURSE_WF_1[23] = { 0xFF }; static u8 act_name_COURSE_WF_2[27] = { 0xFF }; static u8 act_name_COURSE_WF_3[25] = { 0xFF }; static u8 act_name_COURSE_WF_4[31] = { 0xFF }; static u8 act_name_COURSE_WF_5[27] = { 0xFF }; static u8 act_name_COURSE_WF_6[20] = { 0xFF };
+static u8 act_name_COURSE_JRB_1[27] = { 0xFF }; static u8 act_name_COURSE_JRB_2[30] = { 0xFF }; static u8 act_name_COURSE_JRB_3[27] = { 0xFF }; static u8 act_name_COURSE_JRB_4[29] = { 0xFF }; static u8 act_name_COURSE_JRB_5[26] = { 0xFF }; static u8 act_name_COURSE_JRB_6[23] = { 0xFF };
+static u8 act_name_COURSE_CCM_1[18] = { 0xFF }; static u8 act_name_COURSE_CCM_2[18] = { 0xFF }; static u8 act_name_COURSE_CCM_3[17] = { 0xFF }; static u8 act_name_COURSE_CCM_4[29] = { 0xFF }; static u8 act_name_COURSE_CCM_5[24] = { 0xFF }; static u8 act_name_COURSE_CCM_6[21] = { 0xFF };
+static u8 act_name_COURSE_BBH_1[19] = { 0xFF }; static u8 act_name_COURSE_BBH_2[30] = { 0xFF }; static u8 act_name_COURSE_BBH_3[28] = { 0xFF }; static u8 act_name_COURSE_BBH_4[21] = { 0xFF }; static u8 act_name_COURSE_BBH_5[18] = { 0xFF }; static u8 act_name_COURSE_BBH_6[30] = { 0xFF };
+static u8 act_name_COURSE_HMC_1[29] = { 0xFF }; static u8 act_name_COURSE_HMC_2[24] = { 0xFF }; static u8 act_name_COURSE_HMC_3[27] = { 0xFF }; static u8 act_name_COURSE_HMC_4[26] = { 0xFF }; static u8 act_name_COURSE_HMC_5[26] = { 0xFF }; static u8 act_name_COURSE_HMC_6[24] = { 0xFF };
+static u8 act_name_COURSE_LLL_1[19] = { 0xFF }; static u8 act_name_COURSE_LLL_2[18] = { 0xFF }; static u8 act_name_COURSE_LLL_3[29] = { 0xFF }; static u8 act_name_COURSE_LLL_4[20] = { 0xFF }; static u8 act_name_COURSE_LLL_5[29] = { 0xFF }; static u8 act_name_COURSE_LLL_6[29] = { 0xFF };
+static u8 act_name_COURSE_SSL_1[30] = { 0xFF }; static u8 act_name_COURSE_SSL_2[25] = { 0xFF }; static u8 act_name_COURSE_SSL_3[27] = { 0xFF }; static u8 act_name_COURSE_SSL_4[31] = { 0xFF }; static u8 act_name_COURSE_SSL_5[28] = { 0xFF }; static u8 act_name_COURSE_SSL_6[15] = { 0xFF };
+static u8 act_name_COURSE_DDD_1[19] = { 0xFF }; static u8 act_name_COURSE_DDD_2[22] = { 0xFF }; static u8 act_name_COURSE_DDD_3[27] = { 0xFF }; static u8 act_name_COURSE_DDD_4[23] = { 0xFF }; static u8 act_name_COURSE_DDD_5[23] = { 0xFF }; static u8 act_name_COURSE_DDD_6[20] = { 0xFF };
+static u8 act_name_COURSE_SL_1[19] = { 0xFF }; static u8 act_name_COURSE_SL_2[21] = { 0xFF }; static u8 act_name_COURSE_SL_3[19] = { 0xFF }; static u8 act_name_COURSE_SL_4[29] = { 0xFF }; static u8 act_name_COURSE_SL_5[30] = { 0xFF }; static u8 act_name_COURSE_SL_6[15] = { 0xFF };
+static u8 act_name_COURSE_WDW_1[22] = { 0xFF }; static u8 act_name_COURSE_WDW_2[16] = { 0xFF }; static u8 act_name_COURSE_WDW_3[30] = { 0xFF }; static u8 act_name_COURSE_WDW_4[28] = { 0xFF }; static u8 act_name_COURSE_WDW_5[25] = { 0xFF }; static u8 act_name_COURSE_WDW_6[29] = { 0xFF };
+static u8 act_name_COURSE_TTM_1[19] = { 0xFF }; static u8 act_name_COURSE_TTM_2[27] = { 0xFF }; static u8 act_name_COURSE_TTM_3[26] = { 0xFF }; static u8 act_name_COURSE_TTM_4[24] = { 0xFF }; static u8 act_name_COURSE_TTM_5[30] = { 0xFF }; static u8 act_name_COURSE_TTM_6[29] = { 0xFF };
+static u8 act_name_COURSE_THI_1[25] = { 0xFF }; static u8 act_name_COURSE_THI_2[31] = { 0xFF }; static u8 act_name_COURSE_THI_3[29] = { 0xFF }; static u8 act_name_COURSE_THI_4[24] = { 0xFF }; static u8 act_name_COURSE_THI_5[20] = { 0xFF }; static u8 act_name_COURSE_THI_6[20] = { 0xFF };
+static u8 act_name_COURSE_TTC_1[19] = { 0xFF }; static u8 act_name_COURSE_TTC_2[26] = { 0xFF }; static u8 act_name_COURSE_TTC_3[11] = { 0xFF }; static u8 act_name_COURSE_TTC_4[20] = { 0xFF }; static u8 act_name_COURSE_TTC_5[27] = { 0xFF }; static u8 act_name_COURSE_TTC_6[24] = { 0xFF };
+static u8 act_name_COURSE_RR_1[29] = { 0xFF }; static u8 act_name_COURSE_RR_2[25] = { 0xFF }; static u8 act_name_COURSE_RR_3[24] = { 0xFF }; static u8 act_name_COURSE_RR_4[23] = { 0xFF }; static u8 act_name_COURSE_RR_5[18] = { 0xFF }; static u8 act_name_COURSE_RR_6[27] = { 0xFF };
+
+
+
+
+
+
+
+
+
+
+
+static u8 extra_text_0[34] = { 0xFF };
+static u8 extra_text_1[1] = { 0xFF };
+static u8 extra_text_2[1] = { 0xFF };
+static u8 extra_text_3[1] = { 0xFF };
+static u8 extra_text_4[1] = { 0xFF };
+static u8 extra_text_5[1] = { 0xFF };
+static u8 extra_text_6[1] = { 0xFF };
+const u8* seg2_act_name_table[] = {
+act_name_COURSE_BOB_1, act_name_COURSE_BOB_2, act_name_COURSE_BOB_3, act_name_COURSE_BOB_4, act_name_COURSE_BOB_5, act_name_COURSE_BOB_6,
+act_name_COURSE_WF_1, act_name_COURSE_WF_2, act_name_COURSE_WF_3, act_name_COURSE_WF_4, act_name_COURSE_WF_5, act_name_COURSE_WF_6,
+act_name_COURSE_JRB_1, act_name_COURSE_JRB_2, act_name_COURSE_JRB_3, act_name_COURSE_JRB_4, act_name_COURSE_JRB_5, act_name_COURSE_JRB_6,
+act_name_COURSE_CCM_1, act_name_COURSE_CCM_2, act_name_COURSE_CCM_3, act_name_COURSE_CCM_4, act_name_COURSE_CCM_5, act_name_COURSE_CCM_6,
+act_name_COURSE_BBH_1, act_name_COURSE_BBH_2, act_name_COURSE_BBH_3, act_name_COURSE_BBH_4, act_name_COURSE_BBH_5, act_name_COURSE_BBH_6,
+act_name_COURSE_HMC_1, act_name_COURSE_HMC_2, act_name_COURSE_HMC_3, act_name_COURSE_HMC_4, act_name_COURSE_HMC_5, act_name_COURSE_HMC_6,
+act_name_COURSE_LLL_1, act_name_COURSE_LLL_2, act_name_COURSE_LLL_3, act_name_COURSE_LLL_4, act_name_COURSE_LLL_5, act_name_COURSE_LLL_6,
+act_name_COURSE_SSL_1, act_name_COURSE_SSL_2, act_name_COURSE_SSL_3, act_name_COURSE_SSL_4, act_name_COURSE_SSL_5, act_name_COURSE_SSL_6,
+act_name_COURSE_DDD_1, act_name_COURSE_DDD_2, act_name_COURSE_DDD_3, act_name_COURSE_DDD_4, act_name_COURSE_DDD_5, act_name_COURSE_DDD_6,
+act_name_COURSE_SL_1, act_name_COURSE_SL_2, act_name_COURSE_SL_3, act_name_COURSE_SL_4, act_name_COURSE_SL_5, act_name_COURSE_SL_6,
+act_name_COURSE_WDW_1, act_name_COURSE_WDW_2, act_name_COURSE_WDW_3, act_name_COURSE_WDW_4, act_name_COURSE_WDW_5, act_name_COURSE_WDW_6,
+act_name_COURSE_TTM_1, act_name_COURSE_TTM_2, act_name_COURSE_TTM_3, act_name_COURSE_TTM_4, act_name_COURSE_TTM_5, act_name_COURSE_TTM_6,
+act_name_COURSE_THI_1, act_name_COURSE_THI_2, act_name_COURSE_THI_3, act_name_COURSE_THI_4, act_name_COURSE_THI_5, act_name_COURSE_THI_6,
+act_name_COURSE_TTC_1, act_name_COURSE_TTC_2, act_name_COURSE_TTC_3, act_name_COURSE_TTC_4, act_name_COURSE_TTC_5, act_name_COURSE_TTC_6,
+act_name_COURSE_RR_1, act_name_COURSE_RR_2, act_name_COURSE_RR_3, act_name_COURSE_RR_4, act_name_COURSE_RR_5, act_name_COURSE_RR_6,
+
+
+
+
+
+
+
+
+
+
+
+extra_text_0,
+extra_text_1,
+extra_text_2,
+extra_text_3,
+extra_text_4,
+extra_text_5,
+extra_text_6,
+    NULL
+};
+const u8* seg2_act_name_table_original[] = {
+act_name_COURSE_BOB_1, act_name_COURSE_BOB_2, act_name_COURSE_BOB_3, act_name_COURSE_BOB_4, act_name_COURSE_BOB_5, act_name_COURSE_BOB_6,
+act_name_COURSE_WF_1, act_name_COURSE_WF_2, act_name_COURSE_WF_3, act_name_COURSE_WF_4, act_name_COURSE_WF_5, act_name_COURSE_WF_6,
+act_name_COURSE_JRB_1, act_name_COURSE_JRB_2, act_name_COURSE_JRB_3, act_name_COURSE_JRB_4, act_name_COURSE_JRB_5, act_name_COURSE_JRB_6,
+act_name_COURSE_CCM_1, act_name_COURSE_CCM_2, act_name_COURSE_CCM_3, act_name_COURSE_CCM_4, act_name_COURSE_CCM_5, act_name_COURSE_CCM_6,
+act_name_COURSE_BBH_1, act_name_COURSE_BBH_2, act_name_COURSE_BBH_3, act_name_COURSE_BBH_4, act_name_COURSE_BBH_5, act_name_COURSE_BBH_6,
+act_name_COURSE_HMC_1, act_name_COURSE_HMC_2, act_name_COURSE_HMC_3, act_name_COURSE_HMC_4, act_name_COURSE_HMC_5, act_name_COURSE_HMC_6,
+act_name_COURSE_LLL_1, act_name_COURSE_LLL_2, act_name_COURSE_LLL_3, act_name_COURSE_LLL_4, act_name_COURSE_LLL_5, act_name_COURSE_LLL_6,
+act_name_COURSE_SSL_1, act_name_COURSE_SSL_2, act_name_COURSE_SSL_3, act_name_COURSE_SSL_4, act_name_COURSE_SSL_5, act_name_COURSE_SSL_6,
+act_name_COURSE_DDD_1, act_name_COURSE_DDD_2, act_name_COURSE_DDD_3, act_name_COURSE_DDD_4, act_name_COURSE_DDD_5, act_name_COURSE_DDD_6,
+act_name_COURSE_SL_1, act_name_COURSE_SL_2, act_name_COURSE_SL_3, act_name_COURSE_SL_4, act_name_COURSE_SL_5, act_name_COURSE_SL_6,
+act_name_COURSE_WDW_1, act_name_COURSE_WDW_2, act_name_COURSE_WDW_3, act_name_COURSE_WDW_4, act_name_COURSE_WDW_5, act_name_COURSE_WDW_6,
+act_name_COURSE_TTM_1, act_name_COURSE_TTM_2, act_name_COURSE_TTM_3, act_name_COURSE_TTM_4, act_name_COURSE_TTM_5, act_name_COURSE_TTM_6,
+act_name_COURSE_THI_1, act_name_COURSE_THI_2, act_name_COURSE_THI_3, act_name_COURSE_THI_4, act_name_COURSE_THI_5, act_name_COURSE_THI_6,
+act_name_COURSE_TTC_1, act_name_COURSE_TTC_2, act_name_COURSE_TTC_3, act_name_COURSE_TTC_4, act_name_COURSE_TTC_5, act_name_COURSE_TTC_6,
+act_name_COURSE_RR_1, act_name_COURSE_RR_2, act_name_COURSE_RR_3, act_name_COURSE_RR_4, act_name_COURSE_RR_5, act_name_COURSE_RR_6,
+
+
+
+
+
+
+
+
+
+
+
+extra_text_0,
+extra_text_1,
+extra_text_2,
+extra_text_3,
+extra_text_4,
+extra_text_5,
+extra_text_6,
+    NULL
+};
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_000, 0x00108a40, 48390, 0x00007d34, 373);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_001, 0x00108a40, 48390, 0x00007eac, 401);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_002, 0x00108a40, 48390, 0x00008040, 287);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_003, 0x00108a40, 48390, 0x00008160, 307);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_004, 0x00108a40, 48390, 0x00008294, 184);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_005, 0x00108a40, 48390, 0x0000834c, 331);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_006, 0x00108a40, 48390, 0x00008498, 110);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_007, 0x00108a40, 48390, 0x00008508, 112);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_008, 0x00108a40, 48390, 0x00008578, 209);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_009, 0x00108a40, 48390, 0x0000864c, 257);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_010, 0x00108a40, 48390, 0x00008750, 174);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_011, 0x00108a40, 48390, 0x00008800, 178);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_012, 0x00108a40, 48390, 0x000088b4, 177);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_013, 0x00108a40, 48390, 0x00008968, 97);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_014, 0x00108a40, 48390, 0x000089cc, 113);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_015, 0x00108a40, 48390, 0x00008a40, 175);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_016, 0x00108a40, 48390, 0x00008af0, 74);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_017, 0x00108a40, 48390, 0x00008b3c, 444);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_018, 0x00108a40, 48390, 0x00008cf8, 90);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_019, 0x00108a40, 48390, 0x00008d54, 40);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_020, 0x00108a40, 48390, 0x00008d7c, 95);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_021, 0x00108a40, 48390, 0x00008ddc, 68);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_022, 0x00108a40, 48390, 0x00008e20, 34);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_023, 0x00108a40, 48390, 0x00008e44, 51);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_024, 0x00108a40, 48390, 0x00008e78, 110);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_025, 0x00108a40, 48390, 0x00008ee8, 70);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_026, 0x00108a40, 48390, 0x00008f30, 70);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_027, 0x00108a40, 48390, 0x00008f78, 71);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_028, 0x00108a40, 48390, 0x00008fc0, 71);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_029, 0x00108a40, 48390, 0x00009008, 77);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_030, 0x00108a40, 48390, 0x00009058, 448);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_031, 0x00108a40, 48390, 0x00009218, 188);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_032, 0x00108a40, 48390, 0x000092d4, 245);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_033, 0x00108a40, 48390, 0x000093cc, 260);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_034, 0x00108a40, 48390, 0x000094d0, 613);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_035, 0x00108a40, 48390, 0x00009738, 413);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_036, 0x00108a40, 48390, 0x000098d8, 271);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_037, 0x00108a40, 48390, 0x000099e8, 97);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_038, 0x00108a40, 48390, 0x00009a4c, 47);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_039, 0x00108a40, 48390, 0x00009a7c, 373);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_040, 0x00108a40, 48390, 0x00009bf4, 36);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_041, 0x00108a40, 48390, 0x00009c18, 101);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_042, 0x00108a40, 48390, 0x00009c80, 307);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_043, 0x00108a40, 48390, 0x00009db4, 110);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_044, 0x00108a40, 48390, 0x00009e24, 284);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_045, 0x00108a40, 48390, 0x00009f40, 130);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_046, 0x00108a40, 48390, 0x00009fc4, 472);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_047, 0x00108a40, 48390, 0x0000a19c, 33);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_048, 0x00108a40, 48390, 0x0000a1c0, 82);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_049, 0x00108a40, 48390, 0x0000a214, 235);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_050, 0x00108a40, 48390, 0x0000a300, 243);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_051, 0x00108a40, 48390, 0x0000a3f4, 287);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_052, 0x00108a40, 48390, 0x0000a514, 181);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_053, 0x00108a40, 48390, 0x0000a5cc, 162);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_054, 0x00108a40, 48390, 0x0000a670, 105);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_055, 0x00108a40, 48390, 0x0000a6dc, 230);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_056, 0x00108a40, 48390, 0x0000a7c4, 193);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_057, 0x00108a40, 48390, 0x0000a888, 240);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_058, 0x00108a40, 48390, 0x0000a978, 160);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_059, 0x00108a40, 48390, 0x0000aa18, 81);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_060, 0x00108a40, 48390, 0x0000aa6c, 468);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_061, 0x00108a40, 48390, 0x0000ac40, 70);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_062, 0x00108a40, 48390, 0x0000ac88, 200);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_063, 0x00108a40, 48390, 0x0000ad50, 178);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_064, 0x00108a40, 48390, 0x0000ae04, 205);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_065, 0x00108a40, 48390, 0x0000aed4, 480);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_066, 0x00108a40, 48390, 0x0000b0b4, 507);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_067, 0x00108a40, 48390, 0x0000b2b0, 198);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_068, 0x00108a40, 48390, 0x0000b378, 167);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_069, 0x00108a40, 48390, 0x0000b420, 122);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_070, 0x00108a40, 48390, 0x0000b49c, 535);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_071, 0x00108a40, 48390, 0x0000b6b4, 146);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_072, 0x00108a40, 48390, 0x0000b748, 98);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_073, 0x00108a40, 48390, 0x0000b7ac, 192);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_074, 0x00108a40, 48390, 0x0000b86c, 304);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_075, 0x00108a40, 48390, 0x0000b99c, 528);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_076, 0x00108a40, 48390, 0x0000bbac, 363);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_077, 0x00108a40, 48390, 0x0000bd18, 46);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_078, 0x00108a40, 48390, 0x0000bd48, 197);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_079, 0x00108a40, 48390, 0x0000be10, 192);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_080, 0x00108a40, 48390, 0x0000bed0, 18);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_081, 0x00108a40, 48390, 0x0000bee4, 123);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_082, 0x00108a40, 48390, 0x0000bf60, 400);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_083, 0x00108a40, 48390, 0x0000c0f0, 137);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_084, 0x00108a40, 48390, 0x0000c17c, 249);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_085, 0x00108a40, 48390, 0x0000c278, 107);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_086, 0x00108a40, 48390, 0x0000c2e4, 61);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_087, 0x00108a40, 48390, 0x0000c324, 88);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_088, 0x00108a40, 48390, 0x0000c37c, 90);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_089, 0x00108a40, 48390, 0x0000c3d8, 252);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_090, 0x00108a40, 48390, 0x0000c4d4, 108);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_091, 0x00108a40, 48390, 0x0000c540, 53);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_092, 0x00108a40, 48390, 0x0000c578, 182);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_093, 0x00108a40, 48390, 0x0000c630, 238);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_094, 0x00108a40, 48390, 0x0000c720, 77);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_095, 0x00108a40, 48390, 0x0000c770, 219);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_096, 0x00108a40, 48390, 0x0000c84c, 176);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_097, 0x00108a40, 48390, 0x0000c8fc, 117);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_098, 0x00108a40, 48390, 0x0000c974, 39);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_099, 0x00108a40, 48390, 0x0000c99c, 104);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_100, 0x00108a40, 48390, 0x0000ca04, 70);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_101, 0x00108a40, 48390, 0x0000ca4c, 217);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_102, 0x00108a40, 48390, 0x0000cb28, 197);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_103, 0x00108a40, 48390, 0x0000cbf0, 74);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_104, 0x00108a40, 48390, 0x0000cc3c, 108);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_105, 0x00108a40, 48390, 0x0000cca8, 221);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_106, 0x00108a40, 48390, 0x0000cd88, 48);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_107, 0x00108a40, 48390, 0x0000cdb8, 80);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_108, 0x00108a40, 48390, 0x0000ce08, 89);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_109, 0x00108a40, 48390, 0x0000ce64, 184);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_110, 0x00108a40, 48390, 0x0000cf1c, 112);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_111, 0x00108a40, 48390, 0x0000cf8c, 87);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_112, 0x00108a40, 48390, 0x0000cfe4, 267);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_113, 0x00108a40, 48390, 0x0000d0f0, 121);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_114, 0x00108a40, 48390, 0x0000d16c, 269);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_115, 0x00108a40, 48390, 0x0000d27c, 116);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_116, 0x00108a40, 48390, 0x0000d2f0, 358);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_117, 0x00108a40, 48390, 0x0000d458, 163);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_118, 0x00108a40, 48390, 0x0000d4fc, 157);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_119, 0x00108a40, 48390, 0x0000d59c, 251);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_120, 0x00108a40, 48390, 0x0000d698, 251);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_121, 0x00108a40, 48390, 0x0000d794, 255);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_122, 0x00108a40, 48390, 0x0000d894, 75);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_123, 0x00108a40, 48390, 0x0000d8e0, 56);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_124, 0x00108a40, 48390, 0x0000d918, 109);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_125, 0x00108a40, 48390, 0x0000d988, 46);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_126, 0x00108a40, 48390, 0x0000d9b8, 50);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_127, 0x00108a40, 48390, 0x0000d9ec, 170);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_128, 0x00108a40, 48390, 0x0000da98, 86);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_129, 0x00108a40, 48390, 0x0000daf0, 234);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_130, 0x00108a40, 48390, 0x0000dbdc, 181);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_131, 0x00108a40, 48390, 0x0000dc94, 357);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_132, 0x00108a40, 48390, 0x0000ddfc, 152);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_133, 0x00108a40, 48390, 0x0000de94, 566);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_134, 0x00108a40, 48390, 0x0000e0cc, 300);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_135, 0x00108a40, 48390, 0x0000e1f8, 335);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_136, 0x00108a40, 48390, 0x0000e348, 493);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_137, 0x00108a40, 48390, 0x0000e538, 251);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_138, 0x00108a40, 48390, 0x0000e634, 66);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_139, 0x00108a40, 48390, 0x0000e678, 118);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_140, 0x00108a40, 48390, 0x0000e6f0, 95);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_141, 0x00108a40, 48390, 0x0000e750, 299);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_142, 0x00108a40, 48390, 0x0000e87c, 186);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_143, 0x00108a40, 48390, 0x0000e938, 138);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_144, 0x00108a40, 48390, 0x0000e9c4, 337);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_145, 0x00108a40, 48390, 0x0000eb18, 279);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_146, 0x00108a40, 48390, 0x0000ec30, 136);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_147, 0x00108a40, 48390, 0x0000ecb8, 331);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_148, 0x00108a40, 48390, 0x0000ee04, 201);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_149, 0x00108a40, 48390, 0x0000eed0, 206);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_150, 0x00108a40, 48390, 0x0000efa0, 303);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_151, 0x00108a40, 48390, 0x0000f0d0, 127);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_152, 0x00108a40, 48390, 0x0000f150, 235);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_153, 0x00108a40, 48390, 0x0000f23c, 130);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_154, 0x00108a40, 48390, 0x0000f2c0, 282);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_155, 0x00108a40, 48390, 0x0000f3dc, 330);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_156, 0x00108a40, 48390, 0x0000f528, 92);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_157, 0x00108a40, 48390, 0x0000f584, 185);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_158, 0x00108a40, 48390, 0x0000f640, 260);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_159, 0x00108a40, 48390, 0x0000f744, 126);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_160, 0x00108a40, 48390, 0x0000f7c4, 92);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_161, 0x00108a40, 48390, 0x0000f820, 530);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_162, 0x00108a40, 48390, 0x0000fa34, 243);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_163, 0x00108a40, 48390, 0x0000fb28, 411);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_164, 0x00108a40, 48390, 0x0000fcc4, 205);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_165, 0x00108a40, 48390, 0x0000fd94, 104);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_166, 0x00108a40, 48390, 0x0000fdfc, 79);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_167, 0x00108a40, 48390, 0x0000fe4c, 170);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_168, 0x00108a40, 48390, 0x0000fef8, 97);
+ROM_ASSET_LOAD_DIALOG(dialog_text_DIALOG_169, 0x00108a40, 48390, 0x0000ff5c, 107);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_BOB, 0x00108a40, 48390, 0x00010d14, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_1, 0x00108a40, 48390, 0x00010fd4, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_2, 0x00108a40, 48390, 0x00010ff0, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_3, 0x00108a40, 48390, 0x00011010, 31);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_4, 0x00108a40, 48390, 0x00011030, 21);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_5, 0x00108a40, 48390, 0x00011048, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BOB_6, 0x00108a40, 48390, 0x00011060, 26);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_WF, 0x00108a40, 48390, 0x00010d2c, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_1, 0x00108a40, 48390, 0x0001107c, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_2, 0x00108a40, 48390, 0x00011094, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_3, 0x00108a40, 48390, 0x000110b0, 25);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_4, 0x00108a40, 48390, 0x000110cc, 31);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_5, 0x00108a40, 48390, 0x000110ec, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WF_6, 0x00108a40, 48390, 0x00011108, 20);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_JRB, 0x00108a40, 48390, 0x00010d40, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_1, 0x00108a40, 48390, 0x0001111c, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_2, 0x00108a40, 48390, 0x00011138, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_3, 0x00108a40, 48390, 0x00011158, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_4, 0x00108a40, 48390, 0x00011174, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_5, 0x00108a40, 48390, 0x00011194, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_JRB_6, 0x00108a40, 48390, 0x000111b0, 23);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_CCM, 0x00108a40, 48390, 0x00010d54, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_1, 0x00108a40, 48390, 0x000111c8, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_2, 0x00108a40, 48390, 0x000111dc, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_3, 0x00108a40, 48390, 0x000111f0, 17);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_4, 0x00108a40, 48390, 0x00011204, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_5, 0x00108a40, 48390, 0x00011224, 24);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_CCM_6, 0x00108a40, 48390, 0x0001123c, 21);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_BBH, 0x00108a40, 48390, 0x00010d6c, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_1, 0x00108a40, 48390, 0x00011254, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_2, 0x00108a40, 48390, 0x00011268, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_3, 0x00108a40, 48390, 0x00011288, 28);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_4, 0x00108a40, 48390, 0x000112a4, 21);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_5, 0x00108a40, 48390, 0x000112bc, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_BBH_6, 0x00108a40, 48390, 0x000112d0, 30);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_HMC, 0x00108a40, 48390, 0x00010d80, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_1, 0x00108a40, 48390, 0x000112f0, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_2, 0x00108a40, 48390, 0x00011310, 24);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_3, 0x00108a40, 48390, 0x00011328, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_4, 0x00108a40, 48390, 0x00011344, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_5, 0x00108a40, 48390, 0x00011360, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_HMC_6, 0x00108a40, 48390, 0x0001137c, 24);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_LLL, 0x00108a40, 48390, 0x00010d94, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_1, 0x00108a40, 48390, 0x00011394, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_2, 0x00108a40, 48390, 0x000113a8, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_3, 0x00108a40, 48390, 0x000113bc, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_4, 0x00108a40, 48390, 0x000113dc, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_5, 0x00108a40, 48390, 0x000113f0, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_LLL_6, 0x00108a40, 48390, 0x00011410, 29);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_SSL, 0x00108a40, 48390, 0x00010da8, 22);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_1, 0x00108a40, 48390, 0x00011430, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_2, 0x00108a40, 48390, 0x00011450, 25);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_3, 0x00108a40, 48390, 0x0001146c, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_4, 0x00108a40, 48390, 0x00011488, 31);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_5, 0x00108a40, 48390, 0x000114a8, 28);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SSL_6, 0x00108a40, 48390, 0x000114c4, 15);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_DDD, 0x00108a40, 48390, 0x00010dc0, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_1, 0x00108a40, 48390, 0x000114d4, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_2, 0x00108a40, 48390, 0x000114e8, 22);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_3, 0x00108a40, 48390, 0x00011500, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_4, 0x00108a40, 48390, 0x000111b0, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_5, 0x00108a40, 48390, 0x00011534, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_DDD_6, 0x00108a40, 48390, 0x0001154c, 20);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_SL, 0x00108a40, 48390, 0x00010dd4, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_1, 0x00108a40, 48390, 0x00011560, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_2, 0x00108a40, 48390, 0x00011574, 21);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_3, 0x00108a40, 48390, 0x0001158c, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_4, 0x00108a40, 48390, 0x000115a0, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_5, 0x00108a40, 48390, 0x000115c0, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_SL_6, 0x00108a40, 48390, 0x000115e0, 15);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_WDW, 0x00108a40, 48390, 0x00010de8, 17);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_1, 0x00108a40, 48390, 0x000115f0, 22);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_2, 0x00108a40, 48390, 0x00011608, 16);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_3, 0x00108a40, 48390, 0x00011618, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_4, 0x00108a40, 48390, 0x00011638, 28);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_5, 0x00108a40, 48390, 0x00011654, 25);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_WDW_6, 0x00108a40, 48390, 0x00011670, 29);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_TTM, 0x00108a40, 48390, 0x00010dfc, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_1, 0x00108a40, 48390, 0x00011690, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_2, 0x00108a40, 48390, 0x000116a4, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_3, 0x00108a40, 48390, 0x000116c0, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_4, 0x00108a40, 48390, 0x000116dc, 24);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_5, 0x00108a40, 48390, 0x000116f4, 30);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTM_6, 0x00108a40, 48390, 0x00011714, 29);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_THI, 0x00108a40, 48390, 0x00010e14, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_1, 0x00108a40, 48390, 0x00011734, 25);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_2, 0x00108a40, 48390, 0x00011750, 31);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_3, 0x00108a40, 48390, 0x00011770, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_4, 0x00108a40, 48390, 0x00011790, 24);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_5, 0x00108a40, 48390, 0x000117a8, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_THI_6, 0x00108a40, 48390, 0x000117bc, 20);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_TTC, 0x00108a40, 48390, 0x00010e28, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_1, 0x00108a40, 48390, 0x000117d0, 19);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_2, 0x00108a40, 48390, 0x000117e4, 26);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_3, 0x00108a40, 48390, 0x00011800, 11);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_4, 0x00108a40, 48390, 0x0001180c, 20);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_5, 0x00108a40, 48390, 0x00011820, 27);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_TTC_6, 0x00108a40, 48390, 0x0001183c, 24);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_RR, 0x00108a40, 48390, 0x00010e3c, 16);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_1, 0x00108a40, 48390, 0x00011854, 29);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_2, 0x00108a40, 48390, 0x00011874, 25);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_3, 0x00108a40, 48390, 0x00011890, 24);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_4, 0x00108a40, 48390, 0x000118a8, 23);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_5, 0x00108a40, 48390, 0x000118c0, 18);
+ROM_ASSET_LOAD_DIALOG(act_name_COURSE_RR_6, 0x00108a40, 48390, 0x000118d4, 27);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_BITDW, 0x00108a40, 48390, 0x00010e4c, 28);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_BITFS, 0x00108a40, 48390, 0x00010e68, 26);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_BITS, 0x00108a40, 48390, 0x00010e84, 21);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_PSS, 0x00108a40, 48390, 0x00010e9c, 31);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_COTMC, 0x00108a40, 48390, 0x00010ebc, 27);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_TOTWC, 0x00108a40, 48390, 0x00010ed8, 25);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_VCUTM, 0x00108a40, 48390, 0x00010ef4, 29);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_WMOTR, 0x00108a40, 48390, 0x00010f14, 31);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_SA, 0x00108a40, 48390, 0x00010f34, 23);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_COURSE_CAKE_END, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(seg2_course_name_table_castle_secret_stars, 0x00108a40, 48390, 0x00010f50, 23);
+ROM_ASSET_LOAD_DIALOG(extra_text_0, 0x00108a40, 48390, 0x000118f0, 34);
+ROM_ASSET_LOAD_DIALOG(extra_text_1, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(extra_text_2, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(extra_text_3, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(extra_text_4, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(extra_text_5, 0x00108a40, 48390, 0x0000000c, 1);
+ROM_ASSET_LOAD_DIALOG(extra_text_6, 0x00108a40, 48390, 0x0000000c, 1);